@@ -0,0 +1,67 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+
+using namespace jsoncons;
+
+void read_json_lines_in_parallel()
+{
+    std::string data = R"(["Name", "Session", "Score", "Completed"]
+["Gilbert", "2013", 24, true]
+["Alexa", "2013", 29, true]
+["May", "2012B", 14, false]
+["Deloise", "2012A", 19, true]
+)";
+
+    std::istringstream is(data);
+    json_lines_reader<json> reader(is, json_lines_options{}.num_threads(2));
+
+    reader.read([](std::size_t line, json&& j)
+    {
+        std::cout << line << ": " << j << "\n";
+    });
+}
+
+// Throughput for an increasing number of worker threads
+void measure_throughput()
+{
+    std::string data;
+    for (std::size_t i = 0; i < 200000; ++i)
+    {
+        data += R"({"id":)" + std::to_string(i) + 
+            R"(,"timestamp":"2024-01-01T00:00:00Z","level":"info","message":"request served","latency":)" + 
+            std::to_string(i % 1000) + R"(.25,"tags":["a","b","c"]})" + "\n";
+    }
+    const double megabytes = static_cast<double>(data.size()) / (1024 * 1024);
+
+    const std::size_t max_threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        std::istringstream is(data);
+        json_lines_reader<json> reader(is, json_lines_options{}.num_threads(threads));
+
+        std::size_t count = 0;
+        auto start = std::chrono::steady_clock::now();
+        reader.read([&](std::size_t, json&&){ ++count; });
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << threads << " threads: " << count << " records, " 
+                  << megabytes / elapsed.count() << " MB/s\n";
+    }
+}
+
+int main()
+{
+    std::cout << "\njson_lines_reader examples\n\n";
+
+    read_json_lines_in_parallel();
+    measure_throughput();
+}
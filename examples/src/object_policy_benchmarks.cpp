@@ -0,0 +1,104 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+// Times building, looking up and erasing the members of large objects with
+// sorted_policy, ordered_policy, hashed_policy and unordered_hashed_policy
+
+#include <jsoncons/json.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <typename F>
+    double time_ms(F f)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double,std::milli>(end - start).count();
+    }
+
+    template <typename Json>
+    void run(const char* name, const std::vector<std::string>& keys, const std::string& text)
+    {
+        Json j(json_object_arg);
+        double insert_ms = time_ms([&]()
+        {
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                j.try_emplace(keys[i], i);
+            }
+        });
+
+        std::size_t found = 0;
+        double find_ms = time_ms([&]()
+        {
+            for (int pass = 0; pass < 10; ++pass)
+            {
+                for (const auto& key : keys)
+                {
+                    found += j.contains(key) ? 1 : 0;
+                }
+            }
+        });
+
+        double parse_ms = time_ms([&]()
+        {
+            Json parsed = Json::parse(text);
+            found += parsed.size();
+        });
+
+        double erase_ms = time_ms([&]()
+        {
+            for (std::size_t i = 0; i < keys.size(); i += 2)
+            {
+                j.erase(keys[i]);
+            }
+        });
+
+        std::cout << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << insert_ms << std::setw(10) << find_ms
+                  << std::setw(10) << parse_ms << std::setw(10) << erase_ms
+                  << "   (" << found << ")\n";
+    }
+
+} // namespace
+
+int main()
+{
+    for (std::size_t count : {100, 10000, 50000})
+    {
+        std::vector<std::string> keys;
+        std::mt19937_64 gen(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            keys.push_back("id-" + std::to_string(gen()));
+        }
+
+        std::string text = "{";
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            if (i > 0)
+            {
+                text.push_back(',');
+            }
+            text += "\"" + keys[i] + "\":" + std::to_string(i);
+        }
+        text.push_back('}');
+
+        std::cout << count << " members" << std::setw(25) << "insert" << std::setw(10) << "find x10"
+                  << std::setw(10) << "parse" << std::setw(10) << "erase" << "   (ms)\n";
+        run<json>("sorted_policy", keys, text);
+        run<ojson>("ordered_policy", keys, text);
+        run<basic_json<char,hashed_policy>>("hashed_policy", keys, text);
+        run<basic_json<char,unordered_hashed_policy>>("unordered_hashed_policy", keys, text);
+        std::cout << "\n";
+    }
+}
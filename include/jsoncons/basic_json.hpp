@@ -8,6 +8,7 @@
 #define JSONCONS_BASIC_JSON_HPP
 
 #include <algorithm> // std::swap
+#include <cmath> // std::trunc
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -30,13 +31,20 @@
 #include <jsoncons/config/version.hpp>
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/conversion_result.hpp>
+#include <jsoncons/cow_json_array.hpp>
+#include <jsoncons/cow_json_object.hpp>
+#include <jsoncons/hashed_json_object.hpp>
+#include <jsoncons/interned_key.hpp>
+#include <jsoncons/json_arena.hpp>
 #include <jsoncons/json_array.hpp>
 #include <jsoncons/json_decoder.hpp>
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_fwd.hpp>
+#include <jsoncons/json_index_parser.hpp>
 #include <jsoncons/ordered_json_object.hpp>
+#include <jsoncons/packed_json_array.hpp>
 #include <jsoncons/sorted_json_object.hpp>
 #include <jsoncons/json_options.hpp>
 #include <jsoncons/json_reader.hpp>
@@ -281,6 +289,62 @@ namespace jsoncons {
         using member_key = std::basic_string<CharT, CharTraits, Allocator>;
     };
 
+    // Hash indexed objects that preserve insertion order
+    struct hashed_policy
+    {
+        template <typename KeyT,typename Json>
+        using object = hashed_json_object<KeyT,Json,std::vector,true>;
+
+        template <typename Json>
+        using array = json_array<Json,std::vector>;
+        
+        template <typename CharT,typename CharTraits,typename Allocator>
+        using member_key = std::basic_string<CharT, CharTraits, Allocator>;
+    };
+
+    // Hash indexed objects in unspecified order, with constant time erase
+    struct unordered_hashed_policy
+    {
+        template <typename KeyT,typename Json>
+        using object = hashed_json_object<KeyT,Json,std::vector,false>;
+
+        template <typename Json>
+        using array = json_array<Json,std::vector>;
+        
+        template <typename CharT,typename CharTraits,typename Allocator>
+        using member_key = std::basic_string<CharT, CharTraits, Allocator>;
+    };
+
+    // The objects and arrays of Policy with basic_interned_key member keys, so that
+    // members with equal keys can share the key text
+    template <typename Policy>
+    struct interned_keys_policy : Policy
+    {
+        template <typename CharT,typename CharTraits,typename Allocator>
+        using member_key = basic_interned_key<CharT, CharTraits, Allocator>;
+    };
+
+    // The objects of Policy with packed_json_array arrays, so that arrays of numbers
+    // of one kind can be held in a contiguous buffer
+    template <typename Policy>
+    struct packed_arrays_policy : Policy
+    {
+        template <typename Json>
+        using array = packed_json_array<Json,std::vector>;
+    };
+
+    // The objects and arrays of Policy held in reference counted blocks, so that copies
+    // share them until they are modified
+    template <typename Policy>
+    struct copy_on_write_policy : Policy
+    {
+        template <typename KeyT,typename Json>
+        using object = cow_json_object<KeyT,Json,typename Policy::template object<KeyT,Json>>;
+
+        template <typename Json>
+        using array = cow_json_array<Json,typename Policy::template array<Json>>;
+    };
+
 
 #if !defined(JSONCONS_NO_DEPRECATED)
     using order_preserving_policy = ordered_policy;
@@ -703,6 +767,54 @@ namespace jsoncons {
                 return ptr_->get_allocator();
             }
         };
+
+        // raw_json_storage
+
+        // Holds the text of a JSON value that is written out as is. To everything but encoders
+        // the value is a string holding that text.
+        struct raw_json_storage
+        {
+            using heap_string_factory_type = jsoncons::heap::heap_string_factory<char_type,null_type,Allocator>;
+            using pointer = typename heap_string_factory_type::pointer;
+
+            uint8_t storage_kind_:4;
+            uint8_t short_str_length_:4;
+            semantic_tag tag_;
+            pointer ptr_;
+
+            raw_json_storage(pointer ptr)
+                : storage_kind_(static_cast<uint8_t>(json_storage_kind::raw_json)), short_str_length_(0), 
+                  tag_(semantic_tag::none), ptr_(ptr)
+            {
+            }
+
+            raw_json_storage(const raw_json_storage& other)
+                : storage_kind_(static_cast<uint8_t>(json_storage_kind::raw_json)), short_str_length_(0), tag_(other.tag_), ptr_(other.ptr_)
+            {
+            }
+
+            raw_json_storage& operator=(const raw_json_storage& other) = delete;
+
+            const char_type* data() const
+            {
+                return ptr_->data();
+            }
+
+            const char_type* c_str() const
+            {
+                return ptr_->c_str();
+            }
+
+            std::size_t length() const
+            {
+                return ptr_->length();
+            }
+
+            Allocator get_allocator() const
+            {
+                return ptr_->get_allocator();
+            }
+        };
 #if defined(__GNUC__) && JSONCONS_GCC_AVAILABLE(12,0,0)
 # pragma GCC diagnostic push
 # pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
@@ -887,6 +999,7 @@ namespace jsoncons {
             short_string_storage short_str_;
             long_string_storage long_str_;
             byte_string_storage byte_str_;
+            raw_json_storage raw_json_;
             array_storage array_;
             object_storage object_;
             empty_object_storage empty_object_;
@@ -896,6 +1009,11 @@ namespace jsoncons {
 
         void destroy()
         {
+            // Memory from a monotonic allocator is reclaimed all at once, without visiting the nodes
+            if (is_monotonic_allocator<Allocator>::value)
+            {
+                return;
+            }
             switch (storage_kind())
             {
                 case json_storage_kind::long_str:
@@ -912,6 +1030,12 @@ namespace jsoncons {
                         byte_string_storage::heap_string_factory_type::destroy(cast<byte_string_storage>().ptr_);
                     }
                     break;
+                case json_storage_kind::raw_json:
+                    if (cast<raw_json_storage>().ptr_ != nullptr)
+                    {
+                        raw_json_storage::heap_string_factory_type::destroy(cast<raw_json_storage>().ptr_);
+                    }
+                    break;
                 case json_storage_kind::array:
                 {
                     if (cast<array_storage>().ptr_ != nullptr)
@@ -1111,6 +1235,16 @@ namespace jsoncons {
             return byte_str_;
         }
 
+        raw_json_storage& cast(identity<raw_json_storage>)
+        {
+            return raw_json_;
+        }
+
+        const raw_json_storage& cast(identity<raw_json_storage>) const
+        {
+            return raw_json_;
+        }
+
         object_storage& cast(identity<object_storage>)
         {
             return object_;
@@ -1180,6 +1314,7 @@ namespace jsoncons {
                 case json_storage_kind::short_str : swap_l_r<TypeL, short_string_storage>(other); break;
                 case json_storage_kind::long_str  : swap_l_r<TypeL, long_string_storage>(other); break;
                 case json_storage_kind::byte_str  : swap_l_r<TypeL, byte_string_storage>(other); break;
+                case json_storage_kind::raw_json  : swap_l_r<TypeL, raw_json_storage>(other); break;
                 case json_storage_kind::array        : swap_l_r<TypeL, array_storage>(other); break;
                 case json_storage_kind::object       : swap_l_r<TypeL, object_storage>(other); break;
                 case json_storage_kind::const_json_ref : swap_l_r<TypeL, const_json_ref_storage>(other); break;
@@ -1224,6 +1359,14 @@ namespace jsoncons {
                         construct<byte_string_storage>(ptr, other.tag());
                         break;
                     }
+                    case json_storage_kind::raw_json:
+                    {
+                        const auto& stor = other.cast<raw_json_storage>();
+                        auto ptr = create_long_string(std::allocator_traits<Allocator>::select_on_container_copy_construction(stor.get_allocator()),
+                            stor.data(), stor.length());
+                        construct<raw_json_storage>(ptr);
+                        break;
+                    }
                     case json_storage_kind::array:
                     {
                         auto ptr = create_array(
@@ -1279,6 +1422,13 @@ namespace jsoncons {
                         construct<byte_string_storage>(ptr, other.tag());
                         break;
                     }
+                    case json_storage_kind::raw_json:
+                    {
+                        const auto& storage = other.cast<raw_json_storage>();
+                        auto ptr = create_long_string(alloc, storage.data(), storage.length());
+                        construct<raw_json_storage>(ptr);
+                        break;
+                    }
                     case json_storage_kind::array:
                     {
                         auto ptr = create_array(alloc, other.cast<array_storage>().value());
@@ -1316,6 +1466,10 @@ namespace jsoncons {
                         construct<byte_string_storage>(other.cast<byte_string_storage>());
                         other.construct<null_storage>();
                         break;
+                    case json_storage_kind::raw_json:
+                        construct<raw_json_storage>(other.cast<raw_json_storage>());
+                        other.construct<null_storage>();
+                        break;
                     case json_storage_kind::array:
                         construct<array_storage>(other.cast<array_storage>());
                         other.construct<null_storage>();
@@ -1344,6 +1498,10 @@ namespace jsoncons {
             {
                 std::memcpy(static_cast<void*>(this), &other, sizeof(basic_json));
             }
+            else if (other.get_allocator() == alloc)
+            {
+                uninitialized_move(std::move(other));
+            }
             else
             {
                 uninitialized_copy_a(other, alloc);
@@ -1387,6 +1545,13 @@ namespace jsoncons {
                         uninitialized_copy_a(other, alloc);
                         break;
                     }
+                    case json_storage_kind::raw_json:
+                    {
+                        auto alloc = cast<raw_json_storage>().get_allocator();
+                        destroy();
+                        uninitialized_copy_a(other, alloc);
+                        break;
+                    }
                     case json_storage_kind::array:
                         cast<array_storage>().assign(other.cast<array_storage>());
                         break;
@@ -1485,6 +1650,7 @@ namespace jsoncons {
                     return json_type::float64;
                 case json_storage_kind::short_str:
                 case json_storage_kind::long_str:
+                case json_storage_kind::raw_json:
                     return json_type::string;
                 case json_storage_kind::byte_str:
                     return json_type::byte_string;
@@ -1559,6 +1725,8 @@ namespace jsoncons {
                     return result_type(in_place, cast<short_string_storage>().data(),cast<short_string_storage>().length());
                 case json_storage_kind::long_str:
                     return result_type(in_place, cast<long_string_storage>().data(),cast<long_string_storage>().length());
+                case json_storage_kind::raw_json:
+                    return result_type(in_place, cast<raw_json_storage>().data(),cast<raw_json_storage>().length());
                 case json_storage_kind::const_json_ref:
                     return result_type(cast<const_json_ref_storage>().value().as_string_view());
                 case json_storage_kind::json_ref:
@@ -1653,6 +1821,22 @@ namespace jsoncons {
             return *result;
         }
 
+        // The text of a raw JSON fragment
+        string_view_type as_raw_json() const
+        {
+            switch (storage_kind())
+            {
+                case json_storage_kind::raw_json:
+                    return string_view_type(cast<raw_json_storage>().data(), cast<raw_json_storage>().length());
+                case json_storage_kind::const_json_ref:
+                    return cast<const_json_ref_storage>().value().as_raw_json();
+                case json_storage_kind::json_ref:
+                    return cast<json_ref_storage>().value().as_raw_json();
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a raw JSON fragment"));
+            }
+        }
+
         int compare(const basic_json& rhs) const noexcept
         {
             if (this == &rhs)
@@ -1862,6 +2046,8 @@ namespace jsoncons {
                                 return as_string_view().compare(rhs.as_string_view());
                             case json_storage_kind::long_str:
                                 return as_string_view().compare(rhs.as_string_view());
+                            case json_storage_kind::raw_json:
+                                return as_string_view().compare(rhs.as_string_view());
                             case json_storage_kind::const_json_ref:
                                 return compare(rhs.cast<const_json_ref_storage>().value());
                             case json_storage_kind::json_ref:
@@ -1924,6 +2110,23 @@ namespace jsoncons {
                             return static_cast<int>(storage_kind()) - static_cast<int>(rhs.storage_kind());
                     }
                     break;
+                case json_storage_kind::raw_json:
+                    // Raw fragments are compared as strings holding their text
+                    switch (rhs.storage_kind())
+                    {
+                        case json_storage_kind::raw_json:
+                            return as_string_view().compare(rhs.as_string_view());
+                        case json_storage_kind::short_str:
+                        case json_storage_kind::long_str:
+                            return -rhs.compare(*this);
+                        case json_storage_kind::const_json_ref:
+                            return compare(rhs.cast<const_json_ref_storage>().value());
+                        case json_storage_kind::json_ref:
+                            return compare(rhs.cast<json_ref_storage>().value());
+                        default:
+                            return static_cast<int>(storage_kind()) - static_cast<int>(rhs.storage_kind());
+                    }
+                    break;
                 default:
                     JSONCONS_UNREACHABLE();
                     break;
@@ -1957,6 +2160,7 @@ namespace jsoncons {
                     case json_storage_kind::short_str: swap_l<short_string_storage>(other); break;
                     case json_storage_kind::long_str: swap_l<long_string_storage>(other); break;
                     case json_storage_kind::byte_str: swap_l<byte_string_storage>(other); break;
+                    case json_storage_kind::raw_json: swap_l<raw_json_storage>(other); break;
                     case json_storage_kind::array: swap_l<array_storage>(other); break;
                     case json_storage_kind::object: swap_l<object_storage>(other); break;
                     case json_storage_kind::const_json_ref: swap_l<const_json_ref_storage>(other); break;
@@ -1975,15 +2179,25 @@ namespace jsoncons {
         parse(const Source& source, 
               const basic_json_decode_options<char_type>& options = basic_json_options<char_type>())
         {
+            auto r = unicode_traits::detect_encoding_from_bom(source.data(), source.size());
+            std::size_t offset = (r.ptr - source.data());
+            if (jsoncons::detail::use_index_parser(options, source.size() - offset) &&
+                (r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+            {
+                json_decoder<basic_json> decoder;
+                if (jsoncons::detail::try_index_parse(decoder, source.data() + offset, source.size() - offset, options, std::allocator<char>()))
+                {
+                    return decoder.get_result();
+                }
+            }
+
             json_decoder<basic_json> decoder;
             basic_json_parser<char_type> parser(options);
 
-            auto r = unicode_traits::detect_encoding_from_bom(source.data(), source.size());
             if (!(r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
             {
                 JSONCONS_THROW(ser_error(json_errc::illegal_unicode_character,parser.line(),parser.column()));
             }
-            std::size_t offset = (r.ptr - source.data());
             parser.update(source.data()+offset,source.size()-offset);
             parser.parse_some(decoder);
             parser.finish_parse(decoder);
@@ -2001,15 +2215,25 @@ namespace jsoncons {
             parse(const allocator_set<allocator_type,TempAlloc>& aset, const Source& source, 
               const basic_json_decode_options<char_type>& options = basic_json_options<char_type>())
         {
-            json_decoder<basic_json> decoder(aset.get_allocator(), aset.get_temp_allocator());
+            auto r = unicode_traits::detect_encoding_from_bom(source.data(), source.size());
+            std::size_t offset = (r.ptr - source.data());
+            if (jsoncons::detail::use_index_parser(options, source.size() - offset) &&
+                (r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+            {
+                json_decoder<basic_json,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
+                if (jsoncons::detail::try_index_parse(decoder, source.data() + offset, source.size() - offset, options, aset.get_temp_allocator()))
+                {
+                    return decoder.get_result();
+                }
+            }
+
+            json_decoder<basic_json,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
             basic_json_parser<char_type,TempAlloc> parser(options, aset.get_temp_allocator());
 
-            auto r = unicode_traits::detect_encoding_from_bom(source.data(), source.size());
             if (!(r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
             {
                 JSONCONS_THROW(ser_error(json_errc::illegal_unicode_character,parser.line(),parser.column()));
             }
-            std::size_t offset = (r.ptr - source.data());
             parser.update(source.data()+offset,source.size()-offset);
             parser.parse_some(decoder);
             parser.finish_parse(decoder);
@@ -2068,7 +2292,7 @@ namespace jsoncons {
         static basic_json parse(const allocator_set<allocator_type,TempAlloc>& aset, std::basic_istream<char_type>& is, 
             const basic_json_decode_options<char_type>& options = basic_json_options<CharT>())
         {
-            json_decoder<basic_json> decoder(aset.get_allocator(), aset.get_temp_allocator());
+            json_decoder<basic_json,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
             basic_json_reader<char_type,stream_source<char_type>,Allocator> reader(is, decoder, options, aset.get_temp_allocator());
             reader.read_next();
             reader.check_done();
@@ -2101,7 +2325,7 @@ namespace jsoncons {
         static basic_json parse(const allocator_set<allocator_type,TempAlloc>& aset, InputIt first, InputIt last, 
                                 const basic_json_decode_options<char_type>& options = basic_json_options<CharT>())
         {
-            json_decoder<basic_json> decoder(aset.get_allocator(), aset.get_temp_allocator());
+            json_decoder<basic_json,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
             basic_json_reader<char_type,iterator_source<InputIt>,Allocator> reader(iterator_source<InputIt>(std::forward<InputIt>(first),
                 std::forward<InputIt>(last)), 
                 decoder, options, aset.get_temp_allocator());
@@ -2758,6 +2982,14 @@ namespace jsoncons {
             construct<byte_string_storage>(ptr, semantic_tag::ext);
         }
 
+        // A raw fragment holds the text of a single JSON value, which JSON encoders copy to their
+        // output as is, and other visitors receive parsed. The text is not checked.
+        basic_json(raw_json_arg_t, const string_view_type& text, const Allocator& alloc = Allocator())
+        {
+            auto ptr = create_long_string(alloc, text.data(), text.size());
+            construct<raw_json_storage>(ptr);
+        }
+
         template <typename InputIterator>
         basic_json(InputIterator first, InputIterator last)
             : basic_json(json_array_arg,first,last,Allocator())
@@ -3152,6 +3384,8 @@ namespace jsoncons {
                     return cast<long_string_storage>().get_allocator();
                 case json_storage_kind::byte_str:
                     return cast<byte_string_storage>().get_allocator();
+                case json_storage_kind::raw_json:
+                    return cast<raw_json_storage>().get_allocator();
                 case json_storage_kind::array:
                     return cast<array_storage>().get_allocator();
                 case json_storage_kind::object:
@@ -3234,7 +3468,7 @@ namespace jsoncons {
 
         bool is_string() const noexcept
         {
-            if (is_string_storage(storage_kind()))
+            if (is_string_storage(storage_kind()) || storage_kind() == json_storage_kind::raw_json)
             {
                 return true;
             }
@@ -3274,6 +3508,21 @@ namespace jsoncons {
             return is_byte_string();
         }
 
+        bool is_raw_json() const noexcept
+        {
+            switch (storage_kind())
+            {
+                case json_storage_kind::raw_json:
+                    return true;
+                case json_storage_kind::const_json_ref:
+                    return cast<const_json_ref_storage>().value().is_raw_json();
+                case json_storage_kind::json_ref:
+                    return cast<json_ref_storage>().value().is_raw_json();
+                default:
+                    return false;
+            }
+        }
+
         bool is_bignum() const
         {
             switch (storage_kind())
@@ -3344,6 +3593,9 @@ namespace jsoncons {
                     return true;
                 case json_storage_kind::uint64:
                     return as_integer<uint64_t>() <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)());
+                case json_storage_kind::short_str:
+                case json_storage_kind::long_str:
+                    return is_integer_text<int64_t>();
                 case json_storage_kind::const_json_ref:
                     return cast<const_json_ref_storage>().value().is_int64();
                 case json_storage_kind::json_ref:
@@ -3361,6 +3613,9 @@ namespace jsoncons {
                     return true;
                 case json_storage_kind::int64:
                     return as_integer<int64_t>() >= 0;
+                case json_storage_kind::short_str:
+                case json_storage_kind::long_str:
+                    return is_integer_text<uint64_t>();
                 case json_storage_kind::const_json_ref:
                     return cast<const_json_ref_storage>().value().is_uint64();
                 case json_storage_kind::json_ref:
@@ -3391,6 +3646,9 @@ namespace jsoncons {
             {
                 case json_storage_kind::float64:
                     return true;
+                case json_storage_kind::short_str:
+                case json_storage_kind::long_str:
+                    return tag() == semantic_tag::bigdec;
                 case json_storage_kind::const_json_ref:
                     return cast<const_json_ref_storage>().value().is_double();
                 case json_storage_kind::json_ref:
@@ -3432,6 +3690,8 @@ namespace jsoncons {
                     return cast<short_string_storage>().length() == 0;
                 case json_storage_kind::long_str:
                     return cast<long_string_storage>().length() == 0;
+                case json_storage_kind::raw_json:
+                    return cast<raw_json_storage>().length() == 0;
                 case json_storage_kind::array:
                     return cast<array_storage>().value().empty();
                 case json_storage_kind::empty_object:
@@ -3675,6 +3935,20 @@ namespace jsoncons {
                     auto result = jsoncons::to_integer<T>(as_string_view().data(), as_string_view().length(), val);
                     if (!result)
                     {
+                        // Decimal text converts as a double would, if the truncated value fits in T
+                        if (tag() == semantic_tag::bigdec)
+                        {
+                            double x{0};
+                            if (jsoncons::decstr_to_double(as_cstring(), as_string_view().length(), x))
+                            {
+                                x = std::trunc(x);
+                                if (x >= static_cast<double>((ext_traits::integer_limits<T>::lowest)()) &&
+                                    x < static_cast<double>((ext_traits::integer_limits<T>::max)()) + 1.0)
+                                {
+                                    return result_type(static_cast<T>(x));
+                                }
+                            }
+                        }
                         return result_type(jsoncons::unexpect, conv_errc::not_integer);
                     }
                     return val;
@@ -3719,6 +3993,9 @@ namespace jsoncons {
                     return (as_integer<int64_t>() >= (ext_traits::integer_limits<T>::lowest)()) && (as_integer<int64_t>() <= (ext_traits::integer_limits<T>::max)());
                 case json_storage_kind::uint64:
                     return as_integer<uint64_t>() <= static_cast<uint64_t>((ext_traits::integer_limits<T>::max)());
+                case json_storage_kind::short_str:
+                case json_storage_kind::long_str:
+                    return is_integer_text<T>();
                 case json_storage_kind::const_json_ref:
                     return cast<const_json_ref_storage>().value().template is_integer<T>();
                 case json_storage_kind::json_ref:
@@ -3764,6 +4041,9 @@ namespace jsoncons {
                     return as_integer<int64_t>() >= 0 && static_cast<uint64_t>(as_integer<int64_t>()) <= (ext_traits::integer_limits<IntegerType>::max)();
                 case json_storage_kind::uint64:
                     return as_integer<uint64_t>() <= (ext_traits::integer_limits<IntegerType>::max)();
+                case json_storage_kind::short_str:
+                case json_storage_kind::long_str:
+                    return is_integer_text<IntegerType>();
                 case json_storage_kind::const_json_ref:
                     return cast<const_json_ref_storage>().value().template is_integer<IntegerType>();
                 case json_storage_kind::json_ref:
@@ -3942,6 +4222,8 @@ namespace jsoncons {
                     return cast<short_string_storage>().c_str();
                 case json_storage_kind::long_str:
                     return cast<long_string_storage>().c_str();
+                case json_storage_kind::raw_json:
+                    return cast<raw_json_storage>().c_str();
                 case json_storage_kind::const_json_ref:
                     return cast<const_json_ref_storage>().value().as_cstring();
                 case json_storage_kind::json_ref:
@@ -4787,6 +5069,40 @@ namespace jsoncons {
 
     private:
 
+        // True if this is integer text, such as a number kept as text by the parser's
+        // lazy_numbers option, that fits in T
+        template <typename T>
+        bool is_integer_text() const noexcept
+        {
+            if (tag() != semantic_tag::bigint)
+            {
+                return false;
+            }
+            T val;
+            auto result = jsoncons::to_integer<T>(as_string_view().data(), as_string_view().length(), val);
+            return result ? true : false;
+        }
+
+        // Sends the elements of an array held in a packed buffer, returns false for other arrays
+        template <typename A>
+        static typename std::enable_if<jsoncons::detail::has_packed_storage<A>::value,bool>::type
+        dump_packed(const A& a, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+        {
+            if (!a.is_packed())
+            {
+                return false;
+            }
+            a.dump_packed(visitor, ec);
+            return true;
+        }
+
+        template <typename A>
+        static typename std::enable_if<!jsoncons::detail::has_packed_storage<A>::value,bool>::type
+        dump_packed(const A&, basic_json_visitor<char_type>&, std::error_code&)
+        {
+            return false;
+        }
+
         void dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
         {
             const ser_context context{};
@@ -4806,6 +5122,16 @@ namespace jsoncons {
                         visitor.byte_string_value(as_byte_string_view(), tag(), context, ec);
                     }
                     break;
+                case json_storage_kind::raw_json:
+                    if (visitor.accepts_raw_json())
+                    {
+                        visitor.raw_json_value(as_raw_json(), context, ec);
+                    }
+                    else
+                    {
+                        jsoncons::detail::parse_raw_json<char_type>(as_raw_json(), visitor, ec);
+                    }
+                    break;
                 case json_storage_kind::half_float:
                     visitor.half_value(cast<half_storage>().value(), tag(), context, ec);
                     break;
@@ -4845,9 +5171,12 @@ namespace jsoncons {
                 {
                     visitor.begin_array(size(), tag(), context, ec);
                     const array& o = cast<array_storage>().value();
-                    for (const_array_iterator it = o.begin(); it != o.end(); ++it)
+                    if (!dump_packed(o, visitor, ec))
                     {
-                        (*it).dump_noflush(visitor, ec);
+                        for (const_array_iterator it = o.begin(); it != o.end(); ++it)
+                        {
+                            (*it).dump_noflush(visitor, ec);
+                        }
                     }
                     visitor.end_array(context, ec);
                     break;
@@ -4881,6 +5210,16 @@ namespace jsoncons {
                         visitor.byte_string_value(as_byte_string_view(), tag(), context, ec);
                     }
                     return ec ? write_result{unexpect, ec} : write_result{};
+                case json_storage_kind::raw_json:
+                    if (visitor.accepts_raw_json())
+                    {
+                        visitor.raw_json_value(as_raw_json(), context, ec);
+                    }
+                    else
+                    {
+                        jsoncons::detail::parse_raw_json<char_type>(as_raw_json(), visitor, ec);
+                    }
+                    return ec ? write_result{unexpect, ec} : write_result{};
                 case json_storage_kind::half_float:
                     visitor.half_value(cast<half_storage>().value(), tag(), context, ec);
                     return ec ? write_result{unexpect, ec} : write_result{};
@@ -4928,12 +5267,22 @@ namespace jsoncons {
                 {
                     visitor.begin_array(size(), tag(), context, ec);
                     const array& o = cast<array_storage>().value();
-                    for (const_array_iterator it = o.begin(); it != o.end(); ++it)
+                    if (dump_packed(o, visitor, ec))
                     {
-                        auto r = (*it).try_dump_noflush(visitor);
-                        if (JSONCONS_UNLIKELY(!r))
+                        if (JSONCONS_UNLIKELY(ec))
                         {
-                            return r;
+                            return write_result{unexpect, ec};
+                        }
+                    }
+                    else
+                    {
+                        for (const_array_iterator it = o.begin(); it != o.end(); ++it)
+                        {
+                            auto r = (*it).try_dump_noflush(visitor);
+                            if (JSONCONS_UNLIKELY(!r))
+                            {
+                                return r;
+                            }
                         }
                     }
                     visitor.end_array(context, ec);
@@ -5162,6 +5511,9 @@ namespace jsoncons {
     using ojson = basic_json<char, ordered_policy, std::allocator<char>>;
     using wojson = basic_json<wchar_t, ordered_policy, std::allocator<char>>;
 
+    using arena_json = basic_json<char,sorted_policy,std::scoped_allocator_adaptor<arena_allocator<char>>>;
+    using arena_ojson = basic_json<char,ordered_policy,std::scoped_allocator_adaptor<arena_allocator<char>>>;
+
     inline namespace literals {
 
     inline 
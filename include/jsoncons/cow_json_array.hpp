@@ -0,0 +1,258 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_COW_JSON_ARRAY_HPP
+#define JSONCONS_COW_JSON_ARRAY_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator> // std::iterator_traits
+#include <utility> // std::move
+
+#include <jsoncons/detail/cow_storage.hpp>
+
+namespace jsoncons {
+
+    // cow_json_array
+
+    // An Array, such as json_array, held in a reference counted block that copies share until
+    // one of them is modified. Const access reads the shared block. Non-const access copies the
+    // block first if it is shared, together with the references to the nested arrays and
+    // objects, so that a modification copies only the path to the modified value.
+    template <typename Json,typename Array>
+    class cow_json_array : public detail::cow_storage<Json,Array>
+    {
+        using base_type = detail::cow_storage<Json,Array>;
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using value_type = Json;
+        using iterator = typename Array::iterator;
+        using const_iterator = typename Array::const_iterator;
+        using reference = typename std::iterator_traits<iterator>::reference;
+        using const_reference = typename std::iterator_traits<const_iterator>::reference;
+
+        cow_json_array() = default;
+
+        explicit cow_json_array(const allocator_type& alloc)
+            : base_type(alloc)
+        {
+        }
+
+        explicit cow_json_array(std::size_t n,
+                                const allocator_type& alloc = allocator_type())
+            : base_type(alloc)
+        {
+            this->emplace(n, alloc);
+        }
+
+        explicit cow_json_array(std::size_t n,
+                                const Json& value,
+                                const allocator_type& alloc = allocator_type())
+            : base_type(alloc)
+        {
+            this->emplace(n, value, alloc);
+        }
+
+        template <typename InputIterator>
+        cow_json_array(InputIterator begin, InputIterator end, const allocator_type& alloc = allocator_type())
+            : base_type(alloc)
+        {
+            this->emplace(begin, end, alloc);
+        }
+
+        cow_json_array(const cow_json_array& other) = default;
+
+        cow_json_array(const cow_json_array& other, const allocator_type& alloc)
+            : base_type(other, alloc)
+        {
+        }
+
+        cow_json_array(cow_json_array&& other) = default;
+
+        cow_json_array(cow_json_array&& other, const allocator_type& alloc)
+            : base_type(std::move(other), alloc)
+        {
+        }
+
+        cow_json_array(const std::initializer_list<Json>& init,
+                       const allocator_type& alloc = allocator_type())
+            : base_type(alloc)
+        {
+            this->emplace(init, alloc);
+        }
+
+        cow_json_array& operator=(const cow_json_array& other) = default;
+
+        cow_json_array& operator=(cow_json_array&& other) = default;
+
+        reference back()
+        {
+            return this->exposed_value().back();
+        }
+
+        const_reference back() const
+        {
+            return this->value().back();
+        }
+
+        void pop_back()
+        {
+            this->mutable_value().pop_back();
+        }
+
+        bool empty() const
+        {
+            const Array* val = this->get();
+            return val == nullptr || val->empty();
+        }
+
+        void swap(cow_json_array& other) noexcept
+        {
+            base_type::swap(other);
+        }
+
+        std::size_t size() const
+        {
+            const Array* val = this->get();
+            return val == nullptr ? 0 : val->size();
+        }
+
+        std::size_t capacity() const
+        {
+            const Array* val = this->get();
+            return val == nullptr ? 0 : val->capacity();
+        }
+
+        // Direct access to data
+        value_type* data() { return this->exposed_value().data(); }
+        const value_type* data() const noexcept
+        {
+            const Array* val = this->get();
+            return val == nullptr ? nullptr : val->data();
+        }
+
+        void clear() {base_type::clear();}
+
+        // Shared blocks are left as they are
+        void shrink_to_fit()
+        {
+            if (!this->is_shared() && this->get() != nullptr)
+            {
+                this->mutable_value().shrink_to_fit();
+            }
+        }
+
+        void reserve(std::size_t n) {this->mutable_value().reserve(n);}
+
+        void resize(std::size_t n) {this->mutable_value().resize(n);}
+
+        void resize(std::size_t n, const Json& val) {this->mutable_value().resize(n,val);}
+
+        iterator erase(const_iterator pos)
+        {
+            std::size_t offset = this->offset_of(pos);
+            Array& val = this->exposed_value();
+            return val.erase(this->const_iterator_at(val, offset));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            std::size_t first_offset = this->offset_of(first);
+            std::size_t last_offset = this->offset_of(last);
+            Array& val = this->exposed_value();
+            return val.erase(this->const_iterator_at(val, first_offset), this->const_iterator_at(val, last_offset));
+        }
+
+        Json& operator[](std::size_t i) {return this->exposed_value()[i];}
+
+        const Json& operator[](std::size_t i) const {return this->value()[i];}
+
+        template <typename T>
+        void push_back(T&& value)
+        {
+            this->mutable_value().push_back(std::forward<T>(value));
+        }
+
+        template <typename T>
+        iterator insert(const_iterator pos, T&& value)
+        {
+            std::size_t offset = this->offset_of(pos);
+            Array& val = this->exposed_value();
+            return val.insert(this->const_iterator_at(val, offset), std::forward<T>(value));
+        }
+
+        template <typename InputIt>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            std::size_t offset = this->offset_of(pos);
+            Array& val = this->exposed_value();
+            return val.insert(this->const_iterator_at(val, offset), first, last);
+        }
+
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            std::size_t offset = this->offset_of(pos);
+            Array& val = this->exposed_value();
+            return val.emplace(this->const_iterator_at(val, offset), std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        Json& emplace_back(Args&&... args)
+        {
+            return this->exposed_value().emplace_back(std::forward<Args>(args)...);
+        }
+
+        iterator begin() {return this->exposed_value().begin();}
+
+        iterator end() {return this->exposed_value().end();}
+
+        const_iterator begin() const
+        {
+            const Array* val = this->get();
+            return val == nullptr ? const_iterator() : val->begin();
+        }
+
+        const_iterator end() const
+        {
+            const Array* val = this->get();
+            return val == nullptr ? const_iterator() : val->end();
+        }
+
+        bool operator==(const cow_json_array& rhs) const noexcept
+        {
+            if (this->same_block(rhs))
+            {
+                return true;
+            }
+            const Array* val = this->get();
+            const Array* rhs_val = rhs.get();
+            if (val == nullptr || rhs_val == nullptr)
+            {
+                return empty() && rhs.empty();
+            }
+            return *val == *rhs_val;
+        }
+
+        bool operator<(const cow_json_array& rhs) const noexcept
+        {
+            if (this->same_block(rhs))
+            {
+                return false;
+            }
+            const Array* val = this->get();
+            const Array* rhs_val = rhs.get();
+            if (val == nullptr || rhs_val == nullptr)
+            {
+                return empty() && !rhs.empty();
+            }
+            return *val < *rhs_val;
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_COW_JSON_ARRAY_HPP
@@ -0,0 +1,362 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_COW_JSON_OBJECT_HPP
+#define JSONCONS_COW_JSON_OBJECT_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <utility> // std::move, std::pair
+
+#include <jsoncons/detail/cow_storage.hpp>
+
+namespace jsoncons {
+
+    // cow_json_object
+
+    // An Object, such as sorted_json_object or ordered_json_object, held in a reference counted
+    // block that copies share until one of them is modified, see cow_json_array.
+    template <typename KeyT,typename Json,typename Object>
+    class cow_json_object : public detail::cow_storage<Json,Object>
+    {
+        using base_type = detail::cow_storage<Json,Object>;
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using key_type = KeyT;
+        using key_value_type = typename Object::key_value_type;
+        using char_type = typename Json::char_type;
+        using string_view_type = typename Json::string_view_type;
+        using size_type = typename Object::size_type;
+        using iterator = typename Object::iterator;
+        using const_iterator = typename Object::const_iterator;
+        using value_type = typename Object::value_type;
+
+        cow_json_object() = default;
+
+        explicit cow_json_object(const allocator_type& alloc)
+            : base_type(alloc)
+        {
+        }
+
+        cow_json_object(const cow_json_object& other) = default;
+
+        cow_json_object(const cow_json_object& other, const allocator_type& alloc)
+            : base_type(other, alloc)
+        {
+        }
+
+        cow_json_object(cow_json_object&& other) = default;
+
+        cow_json_object(cow_json_object&& other, const allocator_type& alloc)
+            : base_type(std::move(other), alloc)
+        {
+        }
+
+        template <typename InputIt>
+        cow_json_object(InputIt first, InputIt last)
+        {
+            this->emplace(first, last, allocator_type());
+        }
+
+        template <typename InputIt>
+        cow_json_object(InputIt first, InputIt last, const allocator_type& alloc)
+            : base_type(alloc)
+        {
+            this->emplace(first, last, alloc);
+        }
+
+        cow_json_object(const std::initializer_list<std::pair<std::basic_string<char_type>,Json>>& init,
+                        const allocator_type& alloc = allocator_type())
+            : base_type(alloc)
+        {
+            this->emplace(init, alloc);
+        }
+
+        cow_json_object& operator=(const cow_json_object& other) = default;
+
+        cow_json_object& operator=(cow_json_object&& other) = default;
+
+        bool empty() const
+        {
+            const Object* val = this->get();
+            return val == nullptr || val->empty();
+        }
+
+        void swap(cow_json_object& other) noexcept
+        {
+            base_type::swap(other);
+        }
+
+        iterator begin() {return this->exposed_value().begin();}
+
+        iterator end() {return this->exposed_value().end();}
+
+        const_iterator begin() const
+        {
+            const Object* val = this->get();
+            return val == nullptr ? const_iterator() : val->begin();
+        }
+
+        const_iterator end() const
+        {
+            const Object* val = this->get();
+            return val == nullptr ? const_iterator() : val->end();
+        }
+
+        std::size_t size() const
+        {
+            const Object* val = this->get();
+            return val == nullptr ? 0 : val->size();
+        }
+
+        std::size_t capacity() const
+        {
+            const Object* val = this->get();
+            return val == nullptr ? 0 : val->capacity();
+        }
+
+        // Direct access to data
+        value_type* data() { return this->exposed_value().data(); }
+        const value_type* data() const noexcept
+        {
+            const Object* val = this->get();
+            return val == nullptr ? nullptr : val->data();
+        }
+
+        void clear() {base_type::clear();}
+
+        // Shared blocks are left as they are
+        void shrink_to_fit()
+        {
+            if (!this->is_shared() && this->get() != nullptr)
+            {
+                this->mutable_value().shrink_to_fit();
+            }
+        }
+
+        void reserve(std::size_t n) {this->mutable_value().reserve(n);}
+
+        Json& at(std::size_t i) {return this->exposed_value().at(i);}
+
+        const Json& at(std::size_t i) const {return this->value().at(i);}
+
+        iterator find(string_view_type key) {return this->exposed_value().find(key);}
+
+        const_iterator find(string_view_type key) const
+        {
+            const Object* val = this->get();
+            return val == nullptr ? const_iterator() : val->find(key);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            std::size_t offset = this->offset_of(pos);
+            Object& val = this->exposed_value();
+            return val.erase(this->const_iterator_at(val, offset));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            std::size_t first_offset = this->offset_of(first);
+            std::size_t last_offset = this->offset_of(last);
+            Object& val = this->exposed_value();
+            return val.erase(this->const_iterator_at(val, first_offset), this->const_iterator_at(val, last_offset));
+        }
+
+        // Does not copy a shared block that does not have key
+        size_type erase(string_view_type key)
+        {
+            const Object* val = this->get();
+            if (val == nullptr || (this->is_shared() && val->find(key) == val->end()))
+            {
+                return 0;
+            }
+            return this->mutable_value().erase(key);
+        }
+
+        template <typename Item>
+        void uninitialized_init(Item* items, std::size_t count)
+        {
+            this->mutable_value().uninitialized_init(items, count);
+        }
+
+        template <typename... Args>
+        void insert(Args&&... args)
+        {
+            this->mutable_value().insert(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        std::pair<iterator,bool> insert_or_assign(const string_view_type& name, T&& value)
+        {
+            return this->exposed_value().insert_or_assign(name, std::forward<T>(value));
+        }
+
+        template <typename T>
+        iterator insert_or_assign(iterator hint, const string_view_type& name, T&& value)
+        {
+            std::size_t offset = this->offset_of(hint);
+            Object& val = this->exposed_value();
+            return val.insert_or_assign(this->iterator_at(val, offset), name, std::forward<T>(value));
+        }
+
+        template <typename... Args>
+        std::pair<iterator,bool> try_emplace(const string_view_type& name, Args&&... args)
+        {
+            return this->exposed_value().try_emplace(name, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        iterator try_emplace(iterator hint, const string_view_type& name, Args&&... args)
+        {
+            std::size_t offset = this->offset_of(hint);
+            Object& val = this->exposed_value();
+            return val.try_emplace(this->iterator_at(val, offset), name, std::forward<Args>(args)...);
+        }
+
+        void merge(const cow_json_object& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                this->mutable_value().merge(*src);
+            }
+        }
+
+        void merge(cow_json_object&& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                if (source.is_shared())
+                {
+                    this->mutable_value().merge(*src);
+                }
+                else
+                {
+                    this->mutable_value().merge(std::move(source.mutable_value()));
+                }
+            }
+        }
+
+        void merge(iterator hint, const cow_json_object& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                std::size_t offset = this->offset_of(hint);
+                Object& val = this->mutable_value();
+                val.merge(this->iterator_at(val, offset), *src);
+            }
+        }
+
+        void merge(iterator hint, cow_json_object&& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                std::size_t offset = this->offset_of(hint);
+                Object& val = this->mutable_value();
+                if (source.is_shared())
+                {
+                    val.merge(this->iterator_at(val, offset), *src);
+                }
+                else
+                {
+                    val.merge(this->iterator_at(val, offset), std::move(source.mutable_value()));
+                }
+            }
+        }
+
+        void merge_or_update(const cow_json_object& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                this->mutable_value().merge_or_update(*src);
+            }
+        }
+
+        void merge_or_update(cow_json_object&& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                if (source.is_shared())
+                {
+                    this->mutable_value().merge_or_update(*src);
+                }
+                else
+                {
+                    this->mutable_value().merge_or_update(std::move(source.mutable_value()));
+                }
+            }
+        }
+
+        void merge_or_update(iterator hint, const cow_json_object& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                std::size_t offset = this->offset_of(hint);
+                Object& val = this->mutable_value();
+                val.merge_or_update(this->iterator_at(val, offset), *src);
+            }
+        }
+
+        void merge_or_update(iterator hint, cow_json_object&& source)
+        {
+            const Object* src = source.get();
+            if (src != nullptr)
+            {
+                std::size_t offset = this->offset_of(hint);
+                Object& val = this->mutable_value();
+                if (source.is_shared())
+                {
+                    val.merge_or_update(this->iterator_at(val, offset), *src);
+                }
+                else
+                {
+                    val.merge_or_update(this->iterator_at(val, offset), std::move(source.mutable_value()));
+                }
+            }
+        }
+
+        bool operator==(const cow_json_object& rhs) const
+        {
+            if (this->same_block(rhs))
+            {
+                return true;
+            }
+            const Object* val = this->get();
+            const Object* rhs_val = rhs.get();
+            if (val == nullptr || rhs_val == nullptr)
+            {
+                return empty() && rhs.empty();
+            }
+            return *val == *rhs_val;
+        }
+
+        bool operator<(const cow_json_object& rhs) const
+        {
+            if (this->same_block(rhs))
+            {
+                return false;
+            }
+            const Object* val = this->get();
+            const Object* rhs_val = rhs.get();
+            if (val == nullptr || rhs_val == nullptr)
+            {
+                return empty() && !rhs.empty();
+            }
+            return *val < *rhs_val;
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_COW_JSON_OBJECT_HPP
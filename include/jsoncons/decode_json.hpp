@@ -34,6 +34,18 @@ try_decode_json(const StringViewLike& s,
     using result_type = read_result<value_type>;
     using char_type = typename StringViewLike::value_type;
 
+    auto r = unicode_traits::detect_encoding_from_bom(s.data(), s.size());
+    std::size_t offset = (r.ptr - s.data());
+    if (jsoncons::detail::use_index_parser(options, s.size() - offset) &&
+        (r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+    {
+        jsoncons::json_decoder<T> decoder;
+        if (jsoncons::detail::try_index_parse(decoder, s.data() + offset, s.size() - offset, options, std::allocator<char>()))
+        {
+            return result_type{decoder.get_result()};
+        }
+    }
+
     std::error_code ec;   
     jsoncons::json_decoder<T> decoder;
     basic_json_reader<char_type, chars_source<char_type>> reader(s, decoder, options);
@@ -166,6 +178,18 @@ try_decode_json(const allocator_set<Alloc,TempAlloc>& aset,
     using result_type = read_result<value_type>;
     using char_type = typename StringViewLike::value_type;
 
+    auto r = unicode_traits::detect_encoding_from_bom(s.data(), s.size());
+    std::size_t offset = (r.ptr - s.data());
+    if (jsoncons::detail::use_index_parser(options, s.size() - offset) &&
+        (r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+    {
+        json_decoder<T,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
+        if (jsoncons::detail::try_index_parse(decoder, s.data() + offset, s.size() - offset, options, aset.get_temp_allocator()))
+        {
+            return result_type{decoder.get_result()};
+        }
+    }
+
     json_decoder<T,TempAlloc> decoder(aset.get_allocator(), aset.get_temp_allocator());
 
     std::error_code ec;   
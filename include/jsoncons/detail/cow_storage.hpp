@@ -0,0 +1,350 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_COW_STORAGE_HPP
+#define JSONCONS_DETAIL_COW_STORAGE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator> // std::distance, std::next
+#include <memory> // std::allocator_traits
+#include <utility> // std::move, std::swap
+#include <vector>
+
+#include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/key_value.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Holds a Container of basic_json values in a reference counted block that copies share
+    // until one of them is modified. Copying takes constant time. A modification first copies
+    // the block if it is shared, but only its top level, since the elements hold their arrays
+    // and objects in shared blocks too.
+    //
+    // A block whose elements have been handed out by non-const reference or iterator is not
+    // shared again, as writes through the reference would be seen by the copies. Copies of
+    // it copy its top level.
+    //
+    // No block means an empty container.
+    template <typename Json,typename Container>
+    class cow_storage : public allocator_holder<typename Json::allocator_type>
+    {
+        template <typename J,typename C>
+        friend class cow_storage;
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using container_type = Container;
+    private:
+        struct block
+        {
+            std::atomic<std::size_t> use_count;
+            bool shareable;
+            Container value;
+
+            template <typename... Args>
+            explicit block(Args&&... args)
+                : use_count(1), shareable(true), value(std::forward<Args>(args)...)
+            {
+            }
+        };
+
+        using block_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<block>;
+        using block_pointer = typename std::allocator_traits<block_allocator_type>::pointer;
+        using value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<Json>;
+
+        block_pointer ptr_{nullptr};
+    public:
+        using allocator_holder<allocator_type>::get_allocator;
+
+        cow_storage() = default;
+
+        explicit cow_storage(const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc)
+        {
+        }
+
+        cow_storage(const cow_storage& other)
+            : allocator_holder<allocator_type>(other.get_allocator())
+        {
+            share_or_copy(other);
+        }
+
+        cow_storage(const cow_storage& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc)
+        {
+            if (alloc == other.get_allocator())
+            {
+                share_or_copy(other);
+            }
+            else if (other.ptr_ != nullptr)
+            {
+                ptr_ = create(other.ptr_->value, alloc);
+            }
+        }
+
+        cow_storage(cow_storage&& other) noexcept
+            : allocator_holder<allocator_type>(other.get_allocator()), ptr_(other.ptr_)
+        {
+            other.ptr_ = nullptr;
+        }
+
+        cow_storage(cow_storage&& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc)
+        {
+            if (alloc == other.get_allocator())
+            {
+                ptr_ = other.ptr_;
+                other.ptr_ = nullptr;
+            }
+            else if (other.ptr_ != nullptr)
+            {
+                ptr_ = create(other.ptr_->value, alloc);
+            }
+        }
+
+        ~cow_storage() noexcept
+        {
+            release();
+        }
+
+        cow_storage& operator=(const cow_storage& other)
+        {
+            if (ptr_ != other.ptr_)
+            {
+                cow_storage temp(other, get_allocator());
+                std::swap(ptr_, temp.ptr_);
+            }
+            return *this;
+        }
+
+        cow_storage& operator=(cow_storage&& other) noexcept
+        {
+            if (get_allocator() == other.get_allocator())
+            {
+                std::swap(ptr_, other.ptr_);
+            }
+            else
+            {
+                cow_storage temp(other, get_allocator());
+                std::swap(ptr_, temp.ptr_);
+            }
+            return *this;
+        }
+
+        // True if another container shares this container's block
+        bool is_shared() const noexcept
+        {
+            return ptr_ != nullptr && ptr_->use_count.load(std::memory_order_acquire) > 1;
+        }
+
+    protected:
+        const Container* get() const noexcept
+        {
+            return ptr_ != nullptr ? std::addressof(ptr_->value) : nullptr;
+        }
+
+        const Container& value() const
+        {
+            JSONCONS_ASSERT(ptr_ != nullptr);
+            return ptr_->value;
+        }
+
+        bool same_block(const cow_storage& other) const noexcept
+        {
+            return ptr_ == other.ptr_;
+        }
+
+        template <typename... Args>
+        void emplace(Args&&... args)
+        {
+            block_pointer p = create(std::forward<Args>(args)...);
+            release();
+            ptr_ = p;
+        }
+
+        // The container for writing that does not hand out references to elements
+        Container& mutable_value()
+        {
+            if (ptr_ == nullptr)
+            {
+                ptr_ = create(get_allocator());
+            }
+            else if (ptr_->use_count.load(std::memory_order_acquire) != 1)
+            {
+                block_pointer p = create(ptr_->value, get_allocator());
+                release();
+                ptr_ = p;
+            }
+            return ptr_->value;
+        }
+
+        // The container for access that may hand out references to elements
+        Container& exposed_value()
+        {
+            Container& val = mutable_value();
+            ptr_->shareable = false;
+            return val;
+        }
+
+        void clear()
+        {
+            if (ptr_ != nullptr)
+            {
+                if (ptr_->use_count.load(std::memory_order_acquire) == 1)
+                {
+                    ptr_->value.clear();
+                }
+                else
+                {
+                    release();
+                }
+            }
+        }
+
+        void swap(cow_storage& other) noexcept
+        {
+            std::swap(ptr_, other.ptr_);
+        }
+
+        // Position of it in the current block, for finding it again after mutable_value()
+        // has copied the block
+        template <typename Iterator>
+        std::size_t offset_of(Iterator it) const
+        {
+            using const_iterator = typename Container::const_iterator;
+            return ptr_ != nullptr ? static_cast<std::size_t>(std::distance(get()->begin(), const_iterator(it))) : 0;
+        }
+
+        static typename Container::const_iterator const_iterator_at(const Container& value, std::size_t offset)
+        {
+            return std::next(value.begin(), offset);
+        }
+
+        static typename Container::iterator iterator_at(Container& value, std::size_t offset)
+        {
+            return std::next(value.begin(), offset);
+        }
+
+    private:
+        void share_or_copy(const cow_storage& other)
+        {
+            if (other.ptr_ != nullptr)
+            {
+                if (other.ptr_->shareable)
+                {
+                    other.ptr_->use_count.fetch_add(1, std::memory_order_relaxed);
+                    ptr_ = other.ptr_;
+                }
+                else
+                {
+                    ptr_ = create(other.ptr_->value, get_allocator());
+                }
+            }
+        }
+
+        template <typename... Args>
+        block_pointer create(Args&&... args)
+        {
+            block_allocator_type alloc(get_allocator());
+            block_pointer p = std::allocator_traits<block_allocator_type>::allocate(alloc, 1);
+            JSONCONS_TRY
+            {
+                std::allocator_traits<block_allocator_type>::construct(alloc, ext_traits::to_plain_pointer(p),
+                    std::forward<Args>(args)...);
+            }
+            JSONCONS_CATCH(...)
+            {
+                std::allocator_traits<block_allocator_type>::deallocate(alloc, p, 1);
+                JSONCONS_RETHROW;
+            }
+            return p;
+        }
+
+        void release() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                if (ptr_->use_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    flatten_and_destroy();
+                    block_allocator_type alloc(get_allocator());
+                    std::allocator_traits<block_allocator_type>::destroy(alloc, ext_traits::to_plain_pointer(ptr_));
+                    std::allocator_traits<block_allocator_type>::deallocate(alloc, ptr_, 1);
+                }
+                ptr_ = nullptr;
+            }
+        }
+
+        static Json& element_value(Json& item)
+        {
+            return item;
+        }
+
+        template <typename KeyT>
+        static Json& element_value(key_value<KeyT,Json>& item)
+        {
+            return item.value();
+        }
+
+        template <typename C>
+        static void move_nested(C& value, std::vector<Json,value_allocator_type>& stack)
+        {
+            for (auto&& item : value)
+            {
+                Json& val = element_value(item);
+                if ((val.storage_kind() == json_storage_kind::array || val.storage_kind() == json_storage_kind::object)
+                    && !val.empty()) // non-empty object or array
+                {
+                    stack.push_back(std::move(val));
+                }
+            }
+            value.clear();
+        }
+
+        // Moves the nested elements of storage to the stack if no other container shares them
+        template <typename C>
+        static void move_nested_if_unique(cow_storage<Json,C>& storage, std::vector<Json,value_allocator_type>& stack)
+        {
+            if (storage.ptr_ != nullptr && storage.ptr_->use_count.load(std::memory_order_acquire) == 1)
+            {
+                move_nested(storage.ptr_->value, stack);
+            }
+        }
+
+        // Destroys deeply nested values without recursion, stopping at blocks that other
+        // containers share
+        void flatten_and_destroy() noexcept
+        {
+            value_allocator_type alloc(get_allocator());
+            std::vector<Json,value_allocator_type> stack(alloc);
+            move_nested(ptr_->value, stack);
+            while (!stack.empty())
+            {
+                Json current = std::move(stack.back());
+                stack.pop_back();
+                switch (current.storage_kind())
+                {
+                    case json_storage_kind::array:
+                        move_nested_if_unique(current.template cast<typename Json::array_storage>().value(), stack);
+                        break;
+                    case json_storage_kind::object:
+                        move_nested_if_unique(current.template cast<typename Json::object_storage>().value(), stack);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_COW_STORAGE_HPP
@@ -0,0 +1,204 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_KEY_INDEX_HPP
+#define JSONCONS_DETAIL_KEY_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // An open addressing, linear probing hash table that maps the a5hash of an object member's
+    // key to the member's position in a sequence container. Keys are not stored, the caller
+    // compares the key at a candidate position.
+    template <typename Allocator>
+    class key_index
+    {
+        struct slot
+        {
+            uint32_t hash;
+            uint32_t pos; // 0 if empty, otherwise the position plus one
+        };
+
+        using slot_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<slot>;
+
+        std::vector<slot,slot_allocator_type> slots_;
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        key_index() = default;
+
+        explicit key_index(const Allocator& alloc)
+            : slots_(slot_allocator_type(alloc))
+        {
+        }
+
+        key_index(const key_index&) = default;
+
+        key_index(const key_index& other, const Allocator& alloc)
+            : slots_(other.slots_, slot_allocator_type(alloc))
+        {
+        }
+
+        key_index(key_index&&) = default;
+
+        key_index(key_index&& other, const Allocator& alloc)
+            : slots_(std::move(other.slots_), slot_allocator_type(alloc))
+        {
+        }
+
+        key_index& operator=(const key_index&) = default;
+        key_index& operator=(key_index&&) = default;
+
+        template <typename CharT>
+        static uint32_t hash(const CharT* data, std::size_t length) noexcept
+        {
+            return a5hash32(reinterpret_cast<const unsigned char*>(data), length*sizeof(CharT), 0);
+        }
+
+        // Smallest power of two table that keeps the load factor at or below 3/4
+        static std::size_t capacity_for(std::size_t n) noexcept
+        {
+            std::size_t capacity = 16;
+            while (capacity*3 < n*4)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        bool empty() const noexcept
+        {
+            return slots_.empty();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return slots_.size();
+        }
+
+        void swap(key_index& other) noexcept
+        {
+            slots_.swap(other.slots_);
+        }
+
+        void clear() noexcept
+        {
+            slots_.clear();
+        }
+
+        // Frees the table
+        void reset()
+        {
+            std::vector<slot,slot_allocator_type>(slots_.get_allocator()).swap(slots_);
+        }
+
+        // Empties the table and resizes it to capacity, a power of two. If allocation fails
+        // the exception propagates with the table left empty, which callers treat as no index.
+        void reset(std::size_t capacity)
+        {
+            slots_.clear();
+            std::vector<slot,slot_allocator_type>(capacity, slot{0,0}, slots_.get_allocator()).swap(slots_);
+        }
+
+        // Returns the first position with hash h for which key_equals(pos) is true, or npos
+        template <typename KeyEquals>
+        std::size_t find(uint32_t h, KeyEquals key_equals) const
+        {
+            const std::size_t mask = slots_.size() - 1;
+            for (std::size_t i = h & mask; slots_[i].pos != 0; i = (i + 1) & mask)
+            {
+                if (slots_[i].hash == h && key_equals(slots_[i].pos - 1))
+                {
+                    return slots_[i].pos - 1;
+                }
+            }
+            return npos;
+        }
+
+        // The table must have a free slot
+        void insert(uint32_t h, std::size_t pos) noexcept
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t i = h & mask;
+            while (slots_[i].pos != 0)
+            {
+                i = (i + 1) & mask;
+            }
+            slots_[i].hash = h;
+            slots_[i].pos = static_cast<uint32_t>(pos + 1);
+        }
+
+        // Removes the entry for pos, which has hash h
+        void remove(uint32_t h, std::size_t pos) noexcept
+        {
+            remove_slot(find_slot(h, pos));
+        }
+
+        // Changes the entry for the member with hash h from position from to position to
+        void move(uint32_t h, std::size_t from, std::size_t to) noexcept
+        {
+            slots_[find_slot(h, from)].pos = static_cast<uint32_t>(to + 1);
+        }
+
+        // Adjusts the positions after erasing the members in [first,last) from the sequence,
+        // which must already have been removed from the table
+        void shift_down(std::size_t first, std::size_t last) noexcept
+        {
+            const uint32_t limit = static_cast<uint32_t>(first + 1);
+            const uint32_t count = static_cast<uint32_t>(last - first);
+            for (auto& s : slots_)
+            {
+                s.pos -= count & (0u - static_cast<uint32_t>(s.pos > limit));
+            }
+        }
+
+    private:
+        std::size_t find_slot(uint32_t h, std::size_t pos) const noexcept
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t i = h & mask;
+            while (slots_[i].pos != pos + 1)
+            {
+                i = (i + 1) & mask;
+            }
+            return i;
+        }
+
+        // Empties slot i, shifting back later entries of its cluster so that no probe sequence is broken
+        void remove_slot(std::size_t i) noexcept
+        {
+            const std::size_t mask = slots_.size() - 1;
+            std::size_t j = i;
+            while (true)
+            {
+                j = (j + 1) & mask;
+                if (slots_[j].pos == 0)
+                {
+                    break;
+                }
+                const std::size_t k = slots_[j].hash & mask;
+                const bool stays = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+                if (!stays)
+                {
+                    slots_[i] = slots_[j];
+                    i = j;
+                }
+            }
+            slots_[i].pos = 0;
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_KEY_INDEX_HPP
@@ -0,0 +1,652 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_HPP
+#define JSONCONS_DETAIL_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/endian.hpp>
+
+// Define JSONCONS_NO_SIMD to restrict the byte scanners to the portable SWAR kernels
+
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_SIMD_SSE2 1
+#    include <emmintrin.h>
+#    if defined(__GNUC__) || defined(__clang__)
+#      define JSONCONS_SIMD_AVX2 1
+#      define JSONCONS_TARGET_AVX2 __attribute__((target("avx2")))
+#      include <immintrin.h>
+#    elif defined(_MSC_VER)
+#      define JSONCONS_SIMD_AVX2 1
+#      define JSONCONS_TARGET_AVX2
+#      include <immintrin.h>
+#      include <intrin.h>
+#    endif
+#  endif
+#endif
+
+namespace jsoncons {
+namespace detail {
+namespace simd {
+
+    enum class isa : uint8_t {swar, sse2, avx2};
+
+#if defined(JSONCONS_SIMD_AVX2)
+    inline bool cpu_has_avx2() noexcept
+    {
+    #if defined(__AVX2__)
+        return true;
+    #elif defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!(osxsave && avx) || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    #else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    #endif
+    }
+#endif
+
+    // The instruction set used by the scanners, detected once per process
+
+    inline isa detect_isa() noexcept
+    {
+    #if defined(JSONCONS_SIMD_AVX2)
+        return cpu_has_avx2() ? isa::avx2 : isa::sse2;
+    #elif defined(JSONCONS_SIMD_SSE2)
+        return isa::sse2;
+    #else
+        return isa::swar;
+    #endif
+    }
+
+    inline isa active_isa() noexcept
+    {
+        static const isa value = detect_isa();
+        return value;
+    }
+
+    JSONCONS_FORCE_INLINE uint64_t swar_load(const char* p) noexcept
+    {
+        uint64_t x;
+        std::memcpy(&x, p, sizeof(x));
+        return x;
+    }
+
+    JSONCONS_FORCE_INLINE constexpr uint64_t swar_broadcast(uint8_t c) noexcept
+    {
+        return 0x0101010101010101ull * c;
+    }
+
+    // High bit set in each byte of x equal to zero (exact for the lowest such byte)
+    JSONCONS_FORCE_INLINE constexpr uint64_t swar_zero_bytes(uint64_t x) noexcept
+    {
+        return (x - 0x0101010101010101ull) & ~x & 0x8080808080808080ull;
+    }
+
+    // High bit set in each byte of x less than n, n <= 128 (exact for the lowest such byte)
+    JSONCONS_FORCE_INLINE constexpr uint64_t swar_less_than(uint64_t x, uint8_t n) noexcept
+    {
+        return (x - swar_broadcast(n)) & ~x & 0x8080808080808080ull;
+    }
+
+    // High bit set in each byte of x equal to c (exact for every byte)
+    JSONCONS_FORCE_INLINE constexpr uint64_t swar_eq_exact(uint64_t x, uint8_t c) noexcept
+    {
+        return ~((((x ^ swar_broadcast(c)) & 0x7f7f7f7f7f7f7f7full) + 0x7f7f7f7f7f7f7f7full) | (x ^ swar_broadcast(c))) & 0x8080808080808080ull;
+    }
+
+    JSONCONS_FORCE_INLINE unsigned popcount64(uint64_t x) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(x));
+    #else
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<unsigned>((x * 0x0101010101010101ull) >> 56);
+    #endif
+    }
+
+    JSONCONS_FORCE_INLINE unsigned ctz64(uint64_t x) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(x));
+    #else
+        unsigned n = 0;
+        while ((x & 1) == 0)
+        {
+            x >>= 1;
+            ++n;
+        }
+        return n;
+    #endif
+    }
+
+    // Index of the most significant set bit, x != 0
+    JSONCONS_FORCE_INLINE unsigned msb64(uint64_t x) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return 63u - static_cast<unsigned>(__builtin_clzll(x));
+    #else
+        unsigned n = 0;
+        while (x >>= 1)
+        {
+            ++n;
+        }
+        return n;
+    #endif
+    }
+
+    // Whitespace scanner result: the first byte that is not a space, tab or line feed,
+    // the number of line feeds skipped, and the start of the last line (nullptr if no
+    // line feed was skipped)
+    struct space_run
+    {
+        const char* ptr;
+        std::size_t newlines;
+        const char* line_start;
+    };
+
+    JSONCONS_FORCE_INLINE void add_newlines(space_run& run, const char* block, uint64_t newline_mask, unsigned bits_per_byte) noexcept
+    {
+        if (newline_mask != 0)
+        {
+            run.newlines += popcount64(newline_mask);
+            run.line_start = block + msb64(newline_mask)/bits_per_byte + 1;
+        }
+    }
+
+    inline space_run skip_space_scalar(space_run run, const char* last) noexcept
+    {
+        while (run.ptr < last)
+        {
+            const char c = *run.ptr;
+            if (c == '\n')
+            {
+                ++run.newlines;
+                run.line_start = ++run.ptr;
+            }
+            else if (c == ' ' || c == '\t')
+            {
+                ++run.ptr;
+            }
+            else
+            {
+                break;
+            }
+        }
+        return run;
+    }
+
+    inline space_run skip_space_swar(space_run run, const char* last) noexcept
+    {
+        JSONCONS_IF_CONSTEXPR (endian::native == endian::little)
+        {
+            while (last - run.ptr >= 8)
+            {
+                const uint64_t x = swar_load(run.ptr);
+                const uint64_t newline = swar_eq_exact(x, '\n');
+                const uint64_t space = swar_eq_exact(x, ' ') | swar_eq_exact(x, '\t') | newline;
+                if (space != 0x8080808080808080ull)
+                {
+                    const unsigned n = ctz64(~space & 0x8080808080808080ull);
+                    add_newlines(run, run.ptr, newline & ((uint64_t(1) << n) - 1), 8);
+                    run.ptr += n / 8;
+                    return run;
+                }
+                add_newlines(run, run.ptr, newline, 8);
+                run.ptr += 8;
+            }
+        }
+        return skip_space_scalar(run, last);
+    }
+
+    // String text scanner: returns a pointer to the first '"', '\\', control character
+    // or non-ASCII byte in [first,last), or last if there is none. Stopping at non-ASCII
+    // bytes lets the caller validate UTF-8 in the same pass.
+
+    inline const char* find_string_special_swar(const char* first, const char* last) noexcept
+    {
+        const char* p = first;
+        while (last - p >= 8)
+        {
+            const uint64_t x = swar_load(p);
+            const uint64_t m = swar_zero_bytes(x ^ swar_broadcast('\"')) |
+                               swar_zero_bytes(x ^ swar_broadcast('\\')) |
+                               swar_less_than(x, 0x20) | (x & 0x8080808080808080ull);
+            if (m != 0)
+            {
+                break;
+            }
+            p += 8;
+        }
+        while (p < last)
+        {
+            const auto c = static_cast<uint8_t>(*p);
+            if (c == '\"' || c == '\\' || c < 0x20 || c >= 0x80)
+            {
+                return p;
+            }
+            ++p;
+        }
+        return p;
+    }
+
+#if defined(JSONCONS_SIMD_SSE2)
+
+    JSONCONS_FORCE_INLINE unsigned ctz32(uint32_t mask) noexcept
+    {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+    #else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+    #endif
+    }
+
+    inline const char* find_string_special_sse2(const char* first, const char* last) noexcept
+    {
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i max_control = _mm_set1_epi8(0x1f);
+
+        const char* p = first;
+        while (last - p >= 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(v, max_control), max_control);
+            const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)), control);
+            const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(special, v)));
+            if (mask != 0)
+            {
+                return p + ctz32(mask);
+            }
+            p += 16;
+        }
+        return find_string_special_swar(p, last);
+    }
+
+    inline space_run skip_space_sse2(space_run run, const char* last) noexcept
+    {
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i newline = _mm_set1_epi8('\n');
+
+        while (last - run.ptr >= 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(run.ptr));
+            const __m128i nl = _mm_cmpeq_epi8(v, newline);
+            const __m128i ws = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)), nl);
+            const auto ws_mask = static_cast<uint32_t>(_mm_movemask_epi8(ws));
+            const auto nl_mask = static_cast<uint32_t>(_mm_movemask_epi8(nl));
+            if (ws_mask != 0xffff)
+            {
+                const unsigned n = ctz32(~ws_mask);
+                add_newlines(run, run.ptr, nl_mask & ((uint32_t(1) << n) - 1), 1);
+                run.ptr += n;
+                return run;
+            }
+            add_newlines(run, run.ptr, nl_mask, 1);
+            run.ptr += 16;
+        }
+        return skip_space_swar(run, last);
+    }
+
+#endif // JSONCONS_SIMD_SSE2
+
+#if defined(JSONCONS_SIMD_AVX2)
+
+    JSONCONS_TARGET_AVX2
+    inline const char* find_string_special_avx2(const char* first, const char* last) noexcept
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i max_control = _mm256_set1_epi8(0x1f);
+
+        const char* p = first;
+        while (last - p >= 32)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            const __m256i control = _mm256_cmpeq_epi8(_mm256_max_epu8(v, max_control), max_control);
+            const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)), control);
+            const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(special, v)));
+            if (mask != 0)
+            {
+                return p + ctz32(mask);
+            }
+            p += 32;
+        }
+        return find_string_special_sse2(p, last);
+    }
+
+    JSONCONS_TARGET_AVX2
+    inline space_run skip_space_avx2(space_run run, const char* last) noexcept
+    {
+        const __m256i space = _mm256_set1_epi8(' ');
+        const __m256i tab = _mm256_set1_epi8('\t');
+        const __m256i newline = _mm256_set1_epi8('\n');
+
+        while (last - run.ptr >= 32)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(run.ptr));
+            const __m256i nl = _mm256_cmpeq_epi8(v, newline);
+            const __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)), nl);
+            const auto ws_mask = static_cast<uint32_t>(_mm256_movemask_epi8(ws));
+            const auto nl_mask = static_cast<uint32_t>(_mm256_movemask_epi8(nl));
+            if (ws_mask != 0xffffffff)
+            {
+                const unsigned n = ctz32(~ws_mask);
+                add_newlines(run, run.ptr, nl_mask & ((uint64_t(1) << n) - 1), 1);
+                run.ptr += n;
+                return run;
+            }
+            add_newlines(run, run.ptr, nl_mask, 1);
+            run.ptr += 32;
+        }
+        return skip_space_sse2(run, last);
+    }
+
+#endif // JSONCONS_SIMD_AVX2
+
+    inline const char* find_string_special(const char* first, const char* last) noexcept
+    {
+        switch (active_isa())
+        {
+    #if defined(JSONCONS_SIMD_AVX2)
+            case isa::avx2:
+                return find_string_special_avx2(first, last);
+    #endif
+    #if defined(JSONCONS_SIMD_SSE2)
+            case isa::sse2:
+                return find_string_special_sse2(first, last);
+    #endif
+            default:
+                return find_string_special_swar(first, last);
+        }
+    }
+
+    // Escape scanner: returns a pointer to the first '"', '\\', control character or DEL in
+    // [first,last), or last if there is none. Also stops at '/' if EscapeSolidus, and at
+    // non-ASCII bytes if EscapeNonAscii.
+
+    template <bool EscapeNonAscii,bool EscapeSolidus>
+    const char* find_escape_special_swar(const char* first, const char* last) noexcept
+    {
+        const char* p = first;
+        while (last - p >= 8)
+        {
+            const uint64_t x = swar_load(p);
+            uint64_t m = swar_zero_bytes(x ^ swar_broadcast('\"')) |
+                         swar_zero_bytes(x ^ swar_broadcast('\\')) |
+                         swar_zero_bytes(x ^ swar_broadcast(0x7f)) |
+                         swar_less_than(x, 0x20);
+            if (EscapeSolidus)
+            {
+                m |= swar_zero_bytes(x ^ swar_broadcast('/'));
+            }
+            if (EscapeNonAscii)
+            {
+                m |= x & 0x8080808080808080ull;
+            }
+            if (m != 0)
+            {
+                break;
+            }
+            p += 8;
+        }
+        while (p < last)
+        {
+            const auto c = static_cast<uint8_t>(*p);
+            if (c == '\"' || c == '\\' || c < 0x20 || c == 0x7f || (EscapeSolidus && c == '/') || (EscapeNonAscii && c >= 0x80))
+            {
+                return p;
+            }
+            ++p;
+        }
+        return p;
+    }
+
+#if defined(JSONCONS_SIMD_SSE2)
+
+    template <bool EscapeNonAscii,bool EscapeSolidus>
+    const char* find_escape_special_sse2(const char* first, const char* last) noexcept
+    {
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i del = _mm_set1_epi8(0x7f);
+        const __m128i solidus = _mm_set1_epi8('/');
+        const __m128i max_control = _mm_set1_epi8(0x1f);
+
+        const char* p = first;
+        while (last - p >= 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(v, max_control), max_control);
+            __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+                                           _mm_or_si128(_mm_cmpeq_epi8(v, del), control));
+            if (EscapeSolidus)
+            {
+                special = _mm_or_si128(special, _mm_cmpeq_epi8(v, solidus));
+            }
+            if (EscapeNonAscii)
+            {
+                special = _mm_or_si128(special, v);
+            }
+            const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+            if (mask != 0)
+            {
+                return p + ctz32(mask);
+            }
+            p += 16;
+        }
+        return find_escape_special_swar<EscapeNonAscii,EscapeSolidus>(p, last);
+    }
+
+#endif // JSONCONS_SIMD_SSE2
+
+#if defined(JSONCONS_SIMD_AVX2)
+
+    template <bool EscapeNonAscii,bool EscapeSolidus>
+    JSONCONS_TARGET_AVX2
+    const char* find_escape_special_avx2(const char* first, const char* last) noexcept
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i del = _mm256_set1_epi8(0x7f);
+        const __m256i solidus = _mm256_set1_epi8('/');
+        const __m256i max_control = _mm256_set1_epi8(0x1f);
+
+        const char* p = first;
+        while (last - p >= 32)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            const __m256i control = _mm256_cmpeq_epi8(_mm256_max_epu8(v, max_control), max_control);
+            __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(v, del), control));
+            if (EscapeSolidus)
+            {
+                special = _mm256_or_si256(special, _mm256_cmpeq_epi8(v, solidus));
+            }
+            if (EscapeNonAscii)
+            {
+                special = _mm256_or_si256(special, v);
+            }
+            const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+            if (mask != 0)
+            {
+                return p + ctz32(mask);
+            }
+            p += 32;
+        }
+        return find_escape_special_sse2<EscapeNonAscii,EscapeSolidus>(p, last);
+    }
+
+#endif // JSONCONS_SIMD_AVX2
+
+    template <bool EscapeNonAscii,bool EscapeSolidus>
+    const char* find_escape_special(const char* first, const char* last) noexcept
+    {
+        switch (active_isa())
+        {
+    #if defined(JSONCONS_SIMD_AVX2)
+            case isa::avx2:
+                return find_escape_special_avx2<EscapeNonAscii,EscapeSolidus>(first, last);
+    #endif
+    #if defined(JSONCONS_SIMD_SSE2)
+            case isa::sse2:
+                return find_escape_special_sse2<EscapeNonAscii,EscapeSolidus>(first, last);
+    #endif
+            default:
+                return find_escape_special_swar<EscapeNonAscii,EscapeSolidus>(first, last);
+        }
+    }
+
+    // Skips spaces, tabs and line feeds, stopping at any other byte (including '\r')
+    inline space_run skip_space(const char* first, const char* last) noexcept
+    {
+        space_run run{first, 0, nullptr};
+        switch (active_isa())
+        {
+    #if defined(JSONCONS_SIMD_AVX2)
+            case isa::avx2:
+                return skip_space_avx2(run, last);
+    #endif
+    #if defined(JSONCONS_SIMD_SSE2)
+            case isa::sse2:
+                return skip_space_sse2(run, last);
+    #endif
+            default:
+                return skip_space_swar(run, last);
+        }
+    }
+
+    // High bit set in each byte of x that is not an ASCII digit (exact for every byte)
+    JSONCONS_FORCE_INLINE constexpr uint64_t swar_non_digits(uint64_t x) noexcept
+    {
+        return ((((x ^ swar_broadcast('0')) & 0x7f7f7f7f7f7f7f7full) + swar_broadcast(0x76)) | (x ^ swar_broadcast('0'))) & 0x8080808080808080ull;
+    }
+
+    // Value of eight ASCII digits loaded in little-endian order
+    JSONCONS_FORCE_INLINE uint32_t swar_parse_eight_digits(uint64_t x) noexcept
+    {
+        x -= swar_broadcast('0');
+        x = (x * 10) + (x >> 8);
+        x = (((x & 0x000000FF000000FFull) * 0x000F424000000064ull) +
+             (((x >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+        return static_cast<uint32_t>(x);
+    }
+
+    // Returns a pointer to the first byte in [first,last) that is not an ASCII digit,
+    // or last if there is none
+    inline const char* skip_digits(const char* first, const char* last) noexcept
+    {
+        JSONCONS_IF_CONSTEXPR (endian::native == endian::little)
+        {
+            while (last - first >= 8)
+            {
+                const uint64_t m = swar_non_digits(swar_load(first));
+                if (m != 0)
+                {
+                    return first + ctz64(m)/8;
+                }
+                first += 8;
+            }
+        }
+        while (first < last && static_cast<uint8_t>(*first - '0') <= 9)
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // Character classes of a 64 byte block, one bit per byte, used to build a structural
+    // index. ops are the structural characters {}[]:, and spaces are JSON whitespace.
+    struct block_classes
+    {
+        uint64_t quotes;
+        uint64_t backslashes;
+        uint64_t ops;
+        uint64_t spaces;
+    };
+
+    inline block_classes classify_block_scalar(const char* p) noexcept
+    {
+        block_classes cls{0, 0, 0, 0};
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            const uint64_t bit = uint64_t(1) << i;
+            switch (p[i])
+            {
+                case '\"': cls.quotes |= bit; break;
+                case '\\': cls.backslashes |= bit; break;
+                case '{': case '}': case '[': case ']': case ':': case ',': cls.ops |= bit; break;
+                case ' ': case '\t': case '\n': case '\r': cls.spaces |= bit; break;
+                default: break;
+            }
+        }
+        return cls;
+    }
+
+#if defined(JSONCONS_SIMD_SSE2)
+
+    inline block_classes classify_block_sse2(const char* p) noexcept
+    {
+        block_classes cls{0, 0, 0, 0};
+        for (unsigned i = 0; i < 4; ++i)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            const __m128i quotes = _mm_cmpeq_epi8(v, _mm_set1_epi8('\"'));
+            const __m128i backslashes = _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'));
+            const __m128i brackets = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('{')), _mm_cmpeq_epi8(v, _mm_set1_epi8('}'))),
+                                                  _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('[')), _mm_cmpeq_epi8(v, _mm_set1_epi8(']'))));
+            const __m128i ops = _mm_or_si128(brackets, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+            const __m128i spaces = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                                                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+            const unsigned shift = 16*i;
+            cls.quotes |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(quotes))) << shift;
+            cls.backslashes |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(backslashes))) << shift;
+            cls.ops |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(ops))) << shift;
+            cls.spaces |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(spaces))) << shift;
+        }
+        return cls;
+    }
+
+#endif // JSONCONS_SIMD_SSE2
+
+    // Classifies the 64 bytes starting at p
+    inline block_classes classify_block(const char* p) noexcept
+    {
+    #if defined(JSONCONS_SIMD_SSE2)
+        return classify_block_sse2(p);
+    #else
+        return classify_block_scalar(p);
+    #endif
+    }
+
+} // namespace simd
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_SIMD_HPP
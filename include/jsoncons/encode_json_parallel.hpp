@@ -0,0 +1,483 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ENCODE_JSON_PARALLEL_HPP
+#define JSONCONS_ENCODE_JSON_PARALLEL_HPP
+
+#include <algorithm> // std::min, std::max
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator> // std::next
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/encode_json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/sink.hpp>
+
+namespace jsoncons {
+
+    // parallel_encode_options
+
+    class parallel_encode_options
+    {
+        std::size_t max_threads_{0};
+        std::size_t min_container_size_{1024};
+    public:
+        parallel_encode_options() = default;
+
+        // The number of threads to encode with, including the calling thread. Zero, the
+        // default, means std::thread::hardware_concurrency().
+        std::size_t max_threads() const
+        {
+            return max_threads_;
+        }
+
+        parallel_encode_options& max_threads(std::size_t value)
+        {
+            max_threads_ = value;
+            return *this;
+        }
+
+        // Arrays and objects with fewer elements are encoded by a single thread
+        std::size_t min_container_size() const
+        {
+            return min_container_size_;
+        }
+
+        parallel_encode_options& min_container_size(std::size_t value)
+        {
+            min_container_size_ = value;
+            return *this;
+        }
+    };
+
+namespace detail {
+
+    template <typename Json>
+    class parallel_json_encoder
+    {
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+
+        // A run of elements of one array or object, encoded by one thread into its own segment
+        struct job
+        {
+            const Json* container;
+            std::size_t first;
+            std::size_t last;
+            int depth; // of container, the root being 1
+            bool with_head; // the container's opening text, when it is not written separately
+            bool with_tail; // the container's closing text, likewise
+            std::size_t segment;
+        };
+
+        const basic_json_encode_options<char_type>& options_;
+        indenting indent_;
+        std::size_t min_container_size_;
+        std::size_t threads_;
+        std::vector<string_type> segments_;
+        std::vector<job> jobs_;
+        std::vector<std::error_code> errors_;
+    public:
+        parallel_json_encoder(const basic_json_encode_options<char_type>& options, indenting indent,
+            const parallel_encode_options& parallel_options)
+            : options_(options), indent_(indent),
+              min_container_size_((std::max)(parallel_options.min_container_size(), std::size_t(1))),
+              threads_(parallel_options.max_threads())
+        {
+            if (threads_ == 0)
+            {
+                threads_ = (std::max)(std::thread::hardware_concurrency(), 1u);
+            }
+        }
+
+        bool is_partitioned(const Json& j) const
+        {
+            return threads_ > 1 && is_large(j);
+        }
+
+        // Requires is_partitioned(j)
+        write_result encode(const Json& j)
+        {
+            if (indent_ == indenting::indent)
+            {
+                // Best effort, only the root is partitioned
+                plan_root_elements(j);
+            }
+            else
+            {
+                plan_container(j, 1);
+            }
+            run();
+
+            for (const auto& ec : errors_)
+            {
+                if (ec)
+                {
+                    return write_result{unexpect, ec};
+                }
+            }
+            return write_result{};
+        }
+
+        const std::vector<string_type>& segments() const
+        {
+            return segments_;
+        }
+
+    private:
+        bool is_large(const Json& j) const
+        {
+            switch (j.type())
+            {
+                case json_type::array:
+                case json_type::object:
+                    return j.size() >= min_container_size_;
+                default:
+                    return false;
+            }
+        }
+
+        // The bytes of the compact encoding of the opening of an object member
+        void write_key(const string_view_type& key, string_type& text) const
+        {
+            string_sink<string_type> sink(text);
+            sink.push_back('\"');
+            jsoncons::detail::escape_string(key.data(), key.length(), options_.escape_all_non_ascii(), options_.escape_solidus(), sink);
+            sink.push_back('\"');
+            sink.push_back(':');
+        }
+
+        // Compact encodings are the same whatever comes before and after, so large nested
+        // containers are partitioned too
+        void plan_container(const Json& container, int depth)
+        {
+            const bool is_object = container.type() == json_type::object;
+            const std::size_t chunk_size = (std::max)(container.size() / (threads_*4), std::size_t(1));
+
+            segments_.emplace_back(1, static_cast<char_type>(is_object ? '{' : '['));
+            std::size_t first = 0;
+            std::size_t index = 0;
+            if (is_object)
+            {
+                for (const auto& member : container.object_range())
+                {
+                    if (is_large(member.value()))
+                    {
+                        if (first < index)
+                        {
+                            add_job(container, first, index, depth, false, false);
+                        }
+                        string_type text;
+                        if (index > 0)
+                        {
+                            text.push_back(',');
+                        }
+                        write_key(string_view_type(member.key().data(), member.key().size()), text);
+                        segments_.push_back(std::move(text));
+                        plan_container(member.value(), depth + 1);
+                        first = index + 1;
+                    }
+                    else if (index + 1 - first == chunk_size)
+                    {
+                        add_job(container, first, index + 1, depth, false, false);
+                        first = index + 1;
+                    }
+                    ++index;
+                }
+            }
+            else
+            {
+                for (const auto& item : container.array_range())
+                {
+                    if (is_large(item))
+                    {
+                        if (first < index)
+                        {
+                            add_job(container, first, index, depth, false, false);
+                        }
+                        if (index > 0)
+                        {
+                            segments_.emplace_back(1, static_cast<char_type>(','));
+                        }
+                        plan_container(item, depth + 1);
+                        first = index + 1;
+                    }
+                    else if (index + 1 - first == chunk_size)
+                    {
+                        add_job(container, first, index + 1, depth, false, false);
+                        first = index + 1;
+                    }
+                    ++index;
+                }
+            }
+            if (first < index)
+            {
+                add_job(container, first, index, depth, false, false);
+            }
+            segments_.emplace_back(1, static_cast<char_type>(is_object ? '}' : ']'));
+        }
+
+        // The first run carries the root's opening and the last its closing
+        void plan_root_elements(const Json& root)
+        {
+            const std::size_t size = root.size();
+            const std::size_t chunk_size = (std::max)(size / (threads_*4), std::size_t(1));
+            for (std::size_t first = 0; first < size; first += chunk_size)
+            {
+                const std::size_t last = (std::min)(first + chunk_size, size);
+                add_job(root, first, last, 1, first == 0, last == size);
+            }
+        }
+
+        void add_job(const Json& container, std::size_t first, std::size_t last, int depth, bool with_head, bool with_tail)
+        {
+            jobs_.push_back(job{std::addressof(container), first, last, depth, with_head, with_tail, segments_.size()});
+            segments_.emplace_back();
+        }
+
+        void run()
+        {
+            errors_.resize(jobs_.size());
+
+            std::atomic<std::size_t> next{0};
+            std::vector<std::exception_ptr> exceptions(jobs_.size());
+            auto work = [&]()
+            {
+                std::size_t i;
+                while ((i = next++) < jobs_.size())
+                {
+                    JSONCONS_TRY
+                    {
+                        auto r = encode_job(jobs_[i]);
+                        if (!r)
+                        {
+                            errors_[i] = r.error();
+                        }
+                    }
+                    JSONCONS_CATCH(...)
+                    {
+                        exceptions[i] = std::current_exception();
+                    }
+                }
+            };
+
+            // Jobs are taken from a shared counter, so if fewer threads can be started the
+            // calling thread and the ones that were started encode the rest
+            std::vector<std::thread> threads;
+            const std::size_t count = (std::min)(threads_, jobs_.size());
+            JSONCONS_TRY
+            {
+                threads.reserve(count > 0 ? count - 1 : 0);
+                for (std::size_t i = 1; i < count; ++i)
+                {
+                    threads.emplace_back(work);
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+            }
+            work();
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+
+            for (auto& e : exceptions)
+            {
+                if (e)
+                {
+                    std::rethrow_exception(e);
+                }
+            }
+        }
+
+        write_result encode_job(const job& jb)
+        {
+            string_type buffer;
+            if (indent_ == indenting::indent)
+            {
+                basic_json_encoder<char_type,string_sink<string_type>> encoder(buffer, options_);
+                return encode_job(jb, encoder, buffer);
+            }
+            else
+            {
+                basic_compact_json_encoder<char_type,string_sink<string_type>> encoder(buffer, options_);
+                return encode_job(jb, encoder, buffer);
+            }
+        }
+
+        // Encodes the run inside dummy arrays standing in for the container's ancestors, so that
+        // nesting depth and indentation come out as in a sequential encoding, and after a dummy
+        // element when the run does not start the container, so that the encoder writes the
+        // separator before it. Then keeps the part of the output that belongs to the run.
+        template <typename Encoder>
+        write_result encode_job(const job& jb, Encoder& encoder, const string_type& buffer)
+        {
+            std::error_code ec;
+            const ser_context context{};
+            const bool is_object = jb.container->type() == json_type::object;
+
+            for (int i = 1; i < jb.depth; ++i)
+            {
+                encoder.begin_array(semantic_tag::none, context, ec);
+            }
+            if (is_object)
+            {
+                encoder.begin_object(jb.container->size(), semantic_tag::none, context, ec);
+                if (jb.first > 0)
+                {
+                    encoder.key(string_view_type(), context, ec);
+                    encoder.null_value(semantic_tag::none, context, ec);
+                }
+            }
+            else
+            {
+                encoder.begin_array(jb.container->size(), semantic_tag::none, context, ec);
+                if (jb.first > 0)
+                {
+                    encoder.null_value(semantic_tag::none, context, ec);
+                }
+            }
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                return write_result{unexpect, ec};
+            }
+
+            const std::size_t begin = jb.with_head ? 0 : buffer.size();
+            if (is_object)
+            {
+                auto range = jb.container->object_range();
+                auto last = std::next(range.begin(), jb.last);
+                for (auto it = std::next(range.begin(), jb.first); it != last; ++it)
+                {
+                    encoder.key(string_view_type((*it).key().data(), (*it).key().size()), context, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return write_result{unexpect, ec};
+                    }
+                    auto r = (*it).value().try_dump(encoder);
+                    if (JSONCONS_UNLIKELY(!r))
+                    {
+                        return r;
+                    }
+                }
+            }
+            else
+            {
+                auto range = jb.container->array_range();
+                auto last = std::next(range.begin(), jb.last);
+                for (auto it = std::next(range.begin(), jb.first); it != last; ++it)
+                {
+                    auto r = (*it).try_dump(encoder);
+                    if (JSONCONS_UNLIKELY(!r))
+                    {
+                        return r;
+                    }
+                }
+            }
+            if (jb.with_tail)
+            {
+                if (is_object)
+                {
+                    encoder.end_object(context, ec);
+                }
+                else
+                {
+                    encoder.end_array(context, ec);
+                }
+                if (JSONCONS_UNLIKELY(ec))
+                {
+                    return write_result{unexpect, ec};
+                }
+            }
+            segments_[jb.segment] = buffer.substr(begin);
+            return write_result{};
+        }
+    };
+
+} // namespace detail
+
+// try_encode_json_parallel
+
+// Encodes large arrays and objects with several threads, each encoding a run of elements into a
+// buffer of its own, and writes the buffers out in order. The compact output is the same as
+// try_encode_json's. The indented output partitions only the root, and may lay out arrays that
+// are wrapped at the line length limit differently.
+
+template <typename CharT,typename Policy,typename Alloc,typename CharContainer>
+typename std::enable_if<ext_traits::is_back_insertable_char_container<CharContainer>::value &&
+                        std::is_same<CharT,typename CharContainer::value_type>::value,write_result>::type
+try_encode_json_parallel(const basic_json<CharT,Policy,Alloc>& j, CharContainer& cont,
+    const basic_json_encode_options<CharT>& options = basic_json_encode_options<CharT>(),
+    indenting indent = indenting::no_indent,
+    const parallel_encode_options& parallel_options = parallel_encode_options())
+{
+    detail::parallel_json_encoder<basic_json<CharT,Policy,Alloc>> encoder(options, indent, parallel_options);
+    if (!encoder.is_partitioned(j))
+    {
+        return try_encode_json(j, cont, options, indent);
+    }
+    auto r = encoder.encode(j);
+    if (r)
+    {
+        string_sink<CharContainer> sink(cont);
+        for (const auto& segment : encoder.segments())
+        {
+            sink.append(segment.data(), segment.size());
+        }
+    }
+    return r;
+}
+
+template <typename CharT,typename Policy,typename Alloc>
+write_result try_encode_json_parallel(const basic_json<CharT,Policy,Alloc>& j, std::basic_ostream<CharT>& os,
+    const basic_json_encode_options<CharT>& options = basic_json_encode_options<CharT>(),
+    indenting indent = indenting::no_indent,
+    const parallel_encode_options& parallel_options = parallel_encode_options())
+{
+    detail::parallel_json_encoder<basic_json<CharT,Policy,Alloc>> encoder(options, indent, parallel_options);
+    if (!encoder.is_partitioned(j))
+    {
+        return try_encode_json(j, os, options, indent);
+    }
+    auto r = encoder.encode(j);
+    if (r)
+    {
+        for (const auto& segment : encoder.segments())
+        {
+            os.write(segment.data(), static_cast<std::streamsize>(segment.size()));
+        }
+        os.flush();
+    }
+    return r;
+}
+
+template <typename... Args>
+void encode_json_parallel(Args&& ... args)
+{
+    auto result = try_encode_json_parallel(std::forward<Args>(args)...);
+    if (!result)
+    {
+        JSONCONS_THROW(ser_error(result.error()));
+    }
+}
+
+} // namespace jsoncons
+
+#endif // JSONCONS_ENCODE_JSON_PARALLEL_HPP
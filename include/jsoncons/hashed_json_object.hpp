@@ -0,0 +1,584 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_HASHED_JSON_OBJECT_HPP
+#define JSONCONS_HASHED_JSON_OBJECT_HPP
+
+#include <algorithm> // std::sort, std::lexicographical_compare
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator> // std::distance
+#include <memory> // std::allocator
+#include <string>
+#include <type_traits> // std::enable_if
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/json_array.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/key_value.hpp>
+#include <jsoncons/detail/key_index.hpp>
+
+namespace jsoncons {
+
+    // Members are kept in a sequence container, in insertion order if InsertionOrder is true,
+    // otherwise in an unspecified order, and found through an open addressing hash table of
+    // positions keyed with a5hash. Erasing a member is O(1) when the order is unspecified, as
+    // the last member is moved into its place. The table is only built for objects with more
+    // than a few members, smaller objects are searched linearly.
+    template <typename KeyT,typename Json,template <typename,typename> class SequenceContainer = std::vector,bool InsertionOrder = true>
+    class hashed_json_object : public allocator_holder<typename Json::allocator_type>
+    {
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using char_type = typename Json::char_type;
+        using key_type = KeyT;
+        using string_view_type = typename Json::string_view_type;
+        using key_value_type = key_value<KeyT,Json>;
+    private:
+        using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
+        using key_value_container_type = SequenceContainer<key_value_type,key_value_allocator_type>;
+        using index_type = jsoncons::detail::key_index<allocator_type>;
+
+        static constexpr std::size_t index_threshold = 8;
+
+        key_value_container_type data_;
+        index_type index_;
+    public:
+        using size_type = typename key_value_container_type::size_type;
+        using iterator = typename key_value_container_type::iterator;
+        using const_iterator = typename key_value_container_type::const_iterator;
+        using value_type = typename key_value_container_type::value_type;
+
+        using allocator_holder<allocator_type>::get_allocator;
+
+        hashed_json_object() = default;
+
+        explicit hashed_json_object(const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(key_value_allocator_type(alloc)),
+              index_(alloc)
+        {
+        }
+
+        hashed_json_object(const hashed_json_object& other)
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              data_(other.data_),
+              index_(other.index_)
+        {
+        }
+
+        hashed_json_object(const hashed_json_object& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(other.data_,key_value_allocator_type(alloc)),
+              index_(other.index_,alloc)
+        {
+        }
+
+        hashed_json_object(hashed_json_object&& other) noexcept
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              data_(std::move(other.data_)),
+              index_(std::move(other.index_))
+        {
+        }
+
+        hashed_json_object(hashed_json_object&& other,const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(std::move(other.data_),key_value_allocator_type(alloc)),
+              index_(std::move(other.index_),alloc)
+        {
+        }
+
+        template <typename InputIt>
+        hashed_json_object(InputIt first, InputIt last)
+        {
+            insert(first, last);
+        }
+
+        template <typename InputIt>
+        hashed_json_object(InputIt first, InputIt last, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(key_value_allocator_type(alloc)),
+              index_(alloc)
+        {
+            insert(first, last);
+        }
+
+        hashed_json_object(const std::initializer_list<std::pair<std::basic_string<char_type>,Json>>& init,
+                    const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(key_value_allocator_type(alloc)),
+              index_(alloc)
+        {
+            reserve(init.size());
+            for (auto& item : init)
+            {
+                insert_or_assign(item.first, item.second);
+            }
+        }
+
+        ~hashed_json_object() noexcept
+        {
+            flatten_and_destroy();
+        }
+
+        hashed_json_object& operator=(const hashed_json_object& other)
+        {
+            data_ = other.data_;
+            index_ = other.index_;
+            return *this;
+        }
+
+        hashed_json_object& operator=(hashed_json_object&& other) noexcept
+        {
+            other.swap(*this);
+            return *this;
+        }
+
+        void swap(hashed_json_object& other) noexcept
+        {
+            data_.swap(other.data_);
+            index_.swap(other.index_);
+        }
+
+        bool empty() const
+        {
+            return data_.empty();
+        }
+
+        iterator begin()
+        {
+            return data_.begin();
+        }
+
+        iterator end()
+        {
+            return data_.end();
+        }
+
+        const_iterator begin() const
+        {
+            return data_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return data_.end();
+        }
+
+        std::size_t size() const {return data_.size();}
+
+        std::size_t capacity() const {return data_.capacity();}
+
+        // Direct access to data
+        value_type* data() noexcept { return data_.data(); }
+        const value_type* data() const noexcept { return data_.data(); }
+
+        void clear()
+        {
+            data_.clear();
+            index_.clear();
+        }
+
+        void shrink_to_fit()
+        {
+            for (std::size_t i = 0; i < data_.size(); ++i)
+            {
+                data_[i].shrink_to_fit();
+            }
+            data_.shrink_to_fit();
+            if (data_.size() <= index_threshold)
+            {
+                index_.reset();
+            }
+            else if (index_type::capacity_for(data_.size()) < index_.capacity())
+            {
+                rebuild_index(index_type::capacity_for(data_.size()));
+            }
+        }
+
+        void reserve(std::size_t n)
+        {
+            data_.reserve(n);
+            if (n > index_threshold && index_type::capacity_for(n) > index_.capacity())
+            {
+                rebuild_index(index_type::capacity_for(n));
+            }
+        }
+
+        Json& at(std::size_t i)
+        {
+            if (i >= data_.size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return data_[i].value();
+        }
+
+        const Json& at(std::size_t i) const
+        {
+            if (i >= data_.size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return data_[i].value();
+        }
+
+        iterator find(string_view_type key) noexcept
+        {
+            return data_.begin() + find_pos(key, hash_key(key));
+        }
+
+        const_iterator find(string_view_type key) const noexcept
+        {
+            return data_.begin() + find_pos(key, hash_key(key));
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            if (pos == data_.end())
+            {
+                return data_.end();
+            }
+            const std::size_t i = static_cast<std::size_t>(pos - data_.begin());
+            return erase_at(i, std::integral_constant<bool,InsertionOrder>());
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            const std::size_t pos = static_cast<std::size_t>(first - data_.begin());
+            data_.erase(first, last);
+            if (!index_.empty())
+            {
+                rebuild_index(index_.capacity());
+            }
+            return data_.begin() + pos;
+        }
+
+        size_type erase(string_view_type key)
+        {
+            const std::size_t pos = find_pos(key, hash_key(key));
+            if (pos == data_.size())
+            {
+                return 0;
+            }
+            erase_at(pos, std::integral_constant<bool,InsertionOrder>());
+            return 1;
+        }
+
+        void uninitialized_init(index_key_value<Json>* items, std::size_t count)
+        {
+            if (count > 0)
+            {
+                reserve(count);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    auto& item = items[i];
+                    const string_view_type name(item.name.data(), item.name.size());
+                    const uint32_t h = hash_key(name);
+                    if (find_pos(name, h) == data_.size())
+                    {
+                        append(h, key_type(std::move(item.name), get_allocator()), std::move(item.value));
+                    }
+                }
+            }
+        }
+
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            reserve(size() + static_cast<std::size_t>(std::distance(first, last)));
+            for (auto it = first; it != last; ++it)
+            {
+                const auto& key = get_key(*it);
+                try_emplace(string_view_type(key.data(), key.size()), get_value(*it));
+            }
+        }
+
+        template <typename InputIt>
+        void insert(sorted_unique_range_tag, InputIt first, InputIt last)
+        {
+            insert(first, last);
+        }
+
+        // insert_or_assign
+
+        template <typename T>
+        std::pair<iterator,bool> insert_or_assign(const string_view_type& name, T&& value)
+        {
+            const uint32_t h = hash_key(name);
+            const std::size_t pos = find_pos(name, h);
+            if (pos == data_.size())
+            {
+                append(h, name, std::forward<T>(value));
+                return std::make_pair(data_.begin() + pos, true);
+            }
+            data_[pos].value(make_value(std::forward<T>(value), typename std::allocator_traits<allocator_type>::is_always_equal()));
+            return std::make_pair(data_.begin() + pos, false);
+        }
+
+        template <typename T>
+        iterator insert_or_assign(iterator, const string_view_type& name, T&& value)
+        {
+            return insert_or_assign(name, std::forward<T>(value)).first;
+        }
+
+        // try_emplace
+
+        template <typename... Args>
+        std::pair<iterator,bool> try_emplace(const string_view_type& name, Args&&... args)
+        {
+            const uint32_t h = hash_key(name);
+            const std::size_t pos = find_pos(name, h);
+            if (pos == data_.size())
+            {
+                append(h, name, std::forward<Args>(args)...);
+                return std::make_pair(data_.begin() + pos, true);
+            }
+            return std::make_pair(data_.begin() + pos, false);
+        }
+
+        template <typename... Args>
+        iterator try_emplace(iterator, const string_view_type& name, Args&&... args)
+        {
+            return try_emplace(name, std::forward<Args>(args)...).first;
+        }
+
+        // merge
+
+        void merge(const hashed_json_object& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                try_emplace((*it).key(),(*it).value());
+            }
+        }
+
+        void merge(hashed_json_object&& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                try_emplace((*it).key(),std::move((*it).value()));
+            }
+        }
+
+        void merge(iterator, const hashed_json_object& source)
+        {
+            merge(source);
+        }
+
+        void merge(iterator, hashed_json_object&& source)
+        {
+            merge(std::move(source));
+        }
+
+        // merge_or_update
+
+        void merge_or_update(const hashed_json_object& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                insert_or_assign((*it).key(),(*it).value());
+            }
+        }
+
+        void merge_or_update(hashed_json_object&& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                insert_or_assign((*it).key(),std::move((*it).value()));
+            }
+        }
+
+        void merge_or_update(iterator, const hashed_json_object& source)
+        {
+            merge_or_update(source);
+        }
+
+        void merge_or_update(iterator, hashed_json_object&& source)
+        {
+            merge_or_update(std::move(source));
+        }
+
+        // Objects with the same members are equal whatever their order
+        bool operator==(const hashed_json_object& rhs) const
+        {
+            if (size() != rhs.size())
+            {
+                return false;
+            }
+            for (const auto& member : data_)
+            {
+                auto it = rhs.find(member.key());
+                if (it == rhs.end() || !(it->value() == member.value()))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Compares the members in key order, consistent with operator==
+        bool operator<(const hashed_json_object& rhs) const
+        {
+            auto lhs_members = sorted_members();
+            auto rhs_members = rhs.sorted_members();
+            return std::lexicographical_compare(lhs_members.begin(), lhs_members.end(),
+                rhs_members.begin(), rhs_members.end(),
+                [](const key_value_type* a, const key_value_type* b) -> bool {return *a < *b;});
+        }
+    private:
+        static uint32_t hash_key(const string_view_type& key) noexcept
+        {
+            return index_type::hash(key.data(), key.size());
+        }
+
+        uint32_t hash_at(std::size_t pos) const noexcept
+        {
+            return index_type::hash(data_[pos].key().data(), data_[pos].key().size());
+        }
+
+        // Position of the member with the key, or size() if there is none
+        std::size_t find_pos(const string_view_type& key, uint32_t h) const noexcept
+        {
+            if (index_.empty())
+            {
+                const std::size_t length = data_.size();
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    if (data_[i].key() == key)
+                    {
+                        return i;
+                    }
+                }
+                return length;
+            }
+            const std::size_t pos = index_.find(h, [&](std::size_t i) -> bool {return data_[i].key() == key;});
+            return pos == index_type::npos ? data_.size() : pos;
+        }
+
+        void rebuild_index(std::size_t capacity)
+        {
+            index_.reset(capacity);
+            for (std::size_t pos = 0; pos < data_.size(); ++pos)
+            {
+                index_.insert(hash_at(pos), pos);
+            }
+        }
+
+        template <typename... Args>
+        void append(uint32_t h, const string_view_type& name, Args&&... args)
+        {
+            append(h, key_type(name.begin(), name.end(), get_allocator()), std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        void append(uint32_t h, key_type&& key, Args&&... args)
+        {
+            data_.emplace_back(std::move(key), std::forward<Args>(args)...);
+            if (!index_.empty())
+            {
+                if (index_type::capacity_for(data_.size()) > index_.capacity())
+                {
+                    rebuild_index(index_type::capacity_for(data_.size()));
+                }
+                else
+                {
+                    index_.insert(h, data_.size() - 1);
+                }
+            }
+            else if (data_.size() > index_threshold)
+            {
+                rebuild_index(index_type::capacity_for(data_.size()));
+            }
+        }
+
+        iterator erase_at(std::size_t pos, std::true_type /* insertion order */)
+        {
+            if (!index_.empty())
+            {
+                index_.remove(hash_at(pos), pos);
+                index_.shift_down(pos, pos + 1);
+            }
+            return data_.erase(data_.begin() + pos);
+        }
+
+        iterator erase_at(std::size_t pos, std::false_type /* unspecified order */)
+        {
+            const std::size_t last = data_.size() - 1;
+            if (!index_.empty())
+            {
+                index_.remove(hash_at(pos), pos);
+                if (pos != last)
+                {
+                    index_.move(hash_at(last), last, pos);
+                }
+            }
+            if (pos != last)
+            {
+                data_[pos] = std::move(data_[last]);
+            }
+            data_.pop_back();
+            return data_.begin() + pos;
+        }
+
+        template <typename T>
+        Json make_value(T&& value, std::true_type /* is_always_equal */)
+        {
+            return Json(std::forward<T>(value));
+        }
+
+        template <typename T>
+        Json make_value(T&& value, std::false_type /* is_always_equal */)
+        {
+            return Json(std::forward<T>(value), get_allocator());
+        }
+
+        std::vector<const key_value_type*> sorted_members() const
+        {
+            std::vector<const key_value_type*> members;
+            members.reserve(data_.size());
+            for (const auto& member : data_)
+            {
+                members.push_back(std::addressof(member));
+            }
+            std::sort(members.begin(), members.end(),
+                [](const key_value_type* a, const key_value_type* b) -> bool {return a->key() < b->key();});
+            return members;
+        }
+
+        void flatten_and_destroy() noexcept
+        {
+            if (!data_.empty())
+            {
+                json_array<Json> temp(get_allocator());
+
+                for (auto& kv : data_)
+                {
+                    switch (kv.value().storage_kind())
+                    {
+                        case json_storage_kind::array:
+                        case json_storage_kind::object:
+                            if (!kv.value().empty())
+                            {
+                                temp.emplace_back(std::move(kv.value()));
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_HASHED_JSON_OBJECT_HPP
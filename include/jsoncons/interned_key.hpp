@@ -0,0 +1,438 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_INTERNED_KEY_HPP
+#define JSONCONS_INTERNED_KEY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstring> // std::memcpy
+#include <iterator> // std::distance
+#include <memory> // std::allocator
+#include <ostream>
+#include <string>
+#include <type_traits> // std::enable_if
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/key_index.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+namespace jsoncons {
+
+    // An immutable string for object member keys. The text is held in a reference counted
+    // buffer, so copies of a key share one allocation. Copying a key to a different allocator
+    // makes a new buffer, as a basic_string would.
+    template <typename CharT,typename CharTraits = std::char_traits<CharT>,typename Allocator = std::allocator<CharT>>
+    class basic_interned_key
+    {
+    public:
+        using value_type = CharT;
+        using traits_type = CharTraits;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using const_iterator = const CharT*;
+        using iterator = const_iterator;
+        using string_view_type = jsoncons::basic_string_view<CharT,CharTraits>;
+    private:
+        struct rep
+        {
+            std::atomic<std::size_t> count;
+            std::size_t length;
+            Allocator alloc;
+
+            rep(std::size_t len, const Allocator& a)
+                : count(1), length(len), alloc(a)
+            {
+            }
+
+            CharT* chars() noexcept
+            {
+                return reinterpret_cast<CharT*>(this + 1);
+            }
+        };
+
+        using rep_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<rep>;
+
+        rep* rep_{nullptr};
+    public:
+        basic_interned_key() = default;
+
+        explicit basic_interned_key(const Allocator&) noexcept
+        {
+        }
+
+        basic_interned_key(const CharT* s, size_type length, const Allocator& alloc = Allocator())
+            : rep_(create(s, length, alloc))
+        {
+        }
+
+        explicit basic_interned_key(const CharT* s, const Allocator& alloc = Allocator())
+            : rep_(create(s, CharTraits::length(s), alloc))
+        {
+        }
+
+        basic_interned_key(const CharT* first, const CharT* last, const Allocator& alloc = Allocator())
+            : rep_(create(first, static_cast<size_type>(last - first), alloc))
+        {
+        }
+
+        template <typename InputIt,typename = typename std::enable_if<!std::is_integral<InputIt>::value &&
+            !std::is_convertible<InputIt,const CharT*>::value>::type>
+        basic_interned_key(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        {
+            std::basic_string<CharT,CharTraits> s(first, last);
+            rep_ = create(s.data(), s.size(), alloc);
+        }
+
+        explicit basic_interned_key(const string_view_type& sv, const Allocator& alloc = Allocator())
+            : rep_(create(sv.data(), sv.size(), alloc))
+        {
+        }
+
+        template <typename Alloc2>
+        explicit basic_interned_key(const std::basic_string<CharT,CharTraits,Alloc2>& s, const Allocator& alloc = Allocator())
+            : rep_(create(s.data(), s.size(), alloc))
+        {
+        }
+
+        basic_interned_key(const basic_interned_key& other) noexcept
+            : rep_(other.rep_)
+        {
+            add_ref();
+        }
+
+        basic_interned_key(const basic_interned_key& other, const Allocator& alloc)
+        {
+            if (other.rep_ != nullptr && other.rep_->alloc == alloc)
+            {
+                rep_ = other.rep_;
+                add_ref();
+            }
+            else
+            {
+                rep_ = create(other.data(), other.size(), alloc);
+            }
+        }
+
+        basic_interned_key(basic_interned_key&& other) noexcept
+            : rep_(other.rep_)
+        {
+            other.rep_ = nullptr;
+        }
+
+        basic_interned_key(basic_interned_key&& other, const Allocator& alloc)
+        {
+            if (other.rep_ != nullptr && other.rep_->alloc == alloc)
+            {
+                rep_ = other.rep_;
+                other.rep_ = nullptr;
+            }
+            else
+            {
+                rep_ = create(other.data(), other.size(), alloc);
+            }
+        }
+
+        ~basic_interned_key() noexcept
+        {
+            release();
+        }
+
+        basic_interned_key& operator=(const basic_interned_key& other) noexcept
+        {
+            if (rep_ != other.rep_)
+            {
+                release();
+                rep_ = other.rep_;
+                add_ref();
+            }
+            return *this;
+        }
+
+        basic_interned_key& operator=(basic_interned_key&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        void swap(basic_interned_key& other) noexcept
+        {
+            std::swap(rep_, other.rep_);
+        }
+
+        const CharT* data() const noexcept
+        {
+            return rep_ != nullptr ? rep_->chars() : empty_chars();
+        }
+
+        const CharT* c_str() const noexcept
+        {
+            return data();
+        }
+
+        size_type size() const noexcept
+        {
+            return rep_ != nullptr ? rep_->length : 0;
+        }
+
+        size_type length() const noexcept
+        {
+            return size();
+        }
+
+        bool empty() const noexcept
+        {
+            return rep_ == nullptr;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + size();
+        }
+
+        void clear() noexcept
+        {
+            release();
+            rep_ = nullptr;
+        }
+
+        void shrink_to_fit() noexcept
+        {
+        }
+
+        operator string_view_type() const noexcept
+        {
+            return string_view_type(data(), size());
+        }
+
+        int compare(const basic_interned_key& other) const noexcept
+        {
+            return rep_ == other.rep_ ? 0 : string_view_type(*this).compare(string_view_type(other));
+        }
+
+        int compare(const string_view_type& sv) const noexcept
+        {
+            return string_view_type(*this).compare(sv);
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.rep_ == rhs.rep_ || string_view_type(lhs) == string_view_type(rhs);
+        }
+        friend bool operator==(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return string_view_type(lhs) == rhs;
+        }
+        friend bool operator==(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs == string_view_type(rhs);
+        }
+
+        friend bool operator!=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+        friend bool operator<(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+        friend bool operator<(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) > 0;
+        }
+
+        friend bool operator<=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(rhs < lhs);
+        }
+        friend bool operator<=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return !(rhs < lhs);
+        }
+        friend bool operator<=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs < lhs;
+        }
+        friend bool operator>(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return rhs < lhs;
+        }
+        friend bool operator>(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator>=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs < rhs);
+        }
+        friend bool operator>=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return !(lhs < rhs);
+        }
+        friend bool operator>=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs < rhs);
+        }
+
+        friend std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, const basic_interned_key& key)
+        {
+            os.write(key.data(), static_cast<std::streamsize>(key.size()));
+            return os;
+        }
+
+    private:
+        static const CharT* empty_chars() noexcept
+        {
+            static const CharT s[1] = {CharT()};
+            return s;
+        }
+
+        static rep* create(const CharT* s, std::size_t length, const Allocator& alloc)
+        {
+            if (length == 0)
+            {
+                return nullptr;
+            }
+            rep_allocator_type rep_alloc(alloc);
+            auto ptr = rep_alloc.allocate(rep_count(length));
+            rep* r = ::new(ext_traits::to_plain_pointer(ptr)) rep(length, alloc);
+            std::memcpy(r->chars(), s, length*sizeof(CharT));
+            r->chars()[length] = CharT();
+            return r;
+        }
+
+        // Number of rep sized units that hold the header and the null terminated text
+        static std::size_t rep_count(std::size_t length) noexcept
+        {
+            return 1 + ((length + 1)*sizeof(CharT) + sizeof(rep) - 1)/sizeof(rep);
+        }
+
+        void add_ref() noexcept
+        {
+            if (rep_ != nullptr)
+            {
+                rep_->count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void release() noexcept
+        {
+            if (rep_ != nullptr && rep_->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                rep_allocator_type rep_alloc(rep_->alloc);
+                const std::size_t n = rep_count(rep_->length);
+                rep_->~rep();
+                rep_alloc.deallocate(std::pointer_traits<typename std::allocator_traits<rep_allocator_type>::pointer>::pointer_to(*rep_), n);
+            }
+        }
+    };
+
+    using interned_key = basic_interned_key<char>;
+    using winterned_key = basic_interned_key<wchar_t>;
+
+namespace detail {
+
+    // Makes the member keys for json_decoder. Keys that cannot share their text are made afresh.
+    template <typename KeyT,typename TempAlloc>
+    class key_interner
+    {
+    public:
+        explicit key_interner(const TempAlloc&)
+        {
+        }
+
+        template <typename StringView,typename Alloc>
+        KeyT make_key(const StringView& name, const Alloc& alloc)
+        {
+            return KeyT(name.data(), name.size(), alloc);
+        }
+    };
+
+    // Interned keys come from a pool of the keys seen so far in the documents built by a
+    // decoder. The pool stops growing at max_keys, after which new keys are made afresh.
+    template <typename CharT,typename CharTraits,typename Allocator,typename TempAlloc>
+    class key_interner<basic_interned_key<CharT,CharTraits,Allocator>,TempAlloc>
+    {
+        using key_type = basic_interned_key<CharT,CharTraits,Allocator>;
+        using key_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<key_type>;
+        using index_type = jsoncons::detail::key_index<TempAlloc>;
+
+        static constexpr std::size_t max_keys = 4096;
+
+        std::vector<key_type,key_allocator_type> keys_;
+        index_type index_;
+    public:
+        explicit key_interner(const TempAlloc& temp_alloc)
+            : keys_(key_allocator_type(temp_alloc)), index_(temp_alloc)
+        {
+        }
+
+        template <typename StringView>
+        key_type make_key(const StringView& name, const Allocator& alloc)
+        {
+            const uint32_t h = index_type::hash(name.data(), name.size());
+            if (!index_.empty())
+            {
+                const std::size_t pos = index_.find(h, [&](std::size_t i) -> bool
+                    {return keys_[i].size() == name.size() && CharTraits::compare(keys_[i].data(), name.data(), name.size()) == 0;});
+                if (pos != index_type::npos)
+                {
+                    return key_type(keys_[pos], alloc);
+                }
+            }
+            key_type key(name.data(), name.size(), alloc);
+            if (keys_.size() < max_keys)
+            {
+                keys_.push_back(key);
+                if (index_type::capacity_for(keys_.size()) > index_.capacity())
+                {
+                    index_.reset(index_type::capacity_for(keys_.size()));
+                    for (std::size_t i = 0; i < keys_.size(); ++i)
+                    {
+                        index_.insert(index_type::hash(keys_[i].data(), keys_[i].size()), i);
+                    }
+                }
+                else
+                {
+                    index_.insert(h, keys_.size() - 1);
+                }
+            }
+            return key;
+        }
+    };
+
+} // namespace detail
+
+} // namespace jsoncons
+
+#endif // JSONCONS_INTERNED_KEY_HPP
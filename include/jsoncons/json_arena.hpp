@@ -0,0 +1,234 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_ARENA_HPP
+#define JSONCONS_JSON_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <scoped_allocator>
+#include <type_traits>
+
+#include <jsoncons/config/compiler_support.hpp>
+
+namespace jsoncons {
+
+    // json_arena hands out memory from chunks that it owns, bumping a pointer for each
+    // allocation, and gives all of it back at once when it is released or destroyed.
+    // Deallocating a block does nothing, unless it is the most recent allocation.
+    // A json_arena is not safe for concurrent use from several threads.
+
+    class json_arena
+    {
+        struct chunk
+        {
+            chunk* next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t header_size = (sizeof(chunk) + alignof(std::max_align_t) - 1) &
+            ~(alignof(std::max_align_t) - 1);
+
+        chunk* head_{nullptr};
+        char* cur_{nullptr};
+        char* end_{nullptr};
+        std::size_t initial_chunk_size_;
+        std::size_t next_chunk_size_;
+        std::size_t bytes_reserved_{0};
+    public:
+        explicit json_arena(std::size_t initial_chunk_size = 4096)
+            : initial_chunk_size_(initial_chunk_size < 64 ? 64 : initial_chunk_size),
+              next_chunk_size_(initial_chunk_size_)
+        {
+        }
+
+        json_arena(const json_arena&) = delete;
+        json_arena& operator=(const json_arena&) = delete;
+
+        ~json_arena() noexcept
+        {
+            release();
+        }
+
+        void* allocate(std::size_t n, std::size_t alignment)
+        {
+            char* p = align_up(cur_, alignment);
+            if (cur_ == nullptr || n > static_cast<std::size_t>(end_ - p))
+            {
+                add_chunk(n + alignment);
+                p = align_up(cur_, alignment);
+            }
+            cur_ = p + n;
+            return p;
+        }
+
+        void deallocate(void* p, std::size_t n) noexcept
+        {
+            // Give back the most recent allocation, e.g. a vector's buffer before it grows
+            if (static_cast<char*>(p) + n == cur_)
+            {
+                cur_ = static_cast<char*>(p);
+            }
+        }
+
+        // Makes sure that the next n bytes of allocations come from the current chunk, adding a
+        // chunk of n bytes if there is not enough room left in it
+        void reserve(std::size_t n)
+        {
+            if (cur_ == nullptr || n > static_cast<std::size_t>(end_ - cur_))
+            {
+                push_chunk(n);
+            }
+        }
+
+        // Frees every chunk. Anything allocated from the arena must not be used afterwards,
+        // and need not be destroyed.
+        void release() noexcept
+        {
+            while (head_ != nullptr)
+            {
+                chunk* next = head_->next;
+                ::operator delete(static_cast<void*>(head_));
+                head_ = next;
+            }
+            cur_ = nullptr;
+            end_ = nullptr;
+            next_chunk_size_ = initial_chunk_size_;
+            bytes_reserved_ = 0;
+        }
+
+        // Total size of the chunks held by the arena
+        std::size_t bytes_reserved() const noexcept
+        {
+            return bytes_reserved_;
+        }
+
+    private:
+        static char* align_up(char* p, std::size_t alignment) noexcept
+        {
+            const std::uintptr_t u = reinterpret_cast<std::uintptr_t>(p);
+            return p + ((alignment - (u & (alignment - 1))) & (alignment - 1));
+        }
+
+        void add_chunk(std::size_t min_size)
+        {
+            std::size_t size = next_chunk_size_;
+            while (size < min_size)
+            {
+                size *= 2;
+            }
+            push_chunk(size);
+            if (next_chunk_size_ < (std::size_t(1) << 24))
+            {
+                next_chunk_size_ *= 2;
+            }
+        }
+
+        void push_chunk(std::size_t size)
+        {
+            void* mem = ::operator new(header_size + size);
+            chunk* c = static_cast<chunk*>(mem);
+            c->next = head_;
+            c->size = size;
+            head_ = c;
+            cur_ = static_cast<char*>(mem) + header_size;
+            end_ = cur_ + size;
+            bytes_reserved_ += size;
+        }
+    };
+
+    // A stateful allocator that allocates from a json_arena. Like std::pmr::polymorphic_allocator,
+    // it is not propagated on assignment or swap, so a value copied or moved into a document built
+    // on another arena is copied into that arena. basic_json requires it to be wrapped with
+    // std::scoped_allocator_adaptor, as arena_json does.
+
+    template <typename T>
+    class arena_allocator
+    {
+        template <typename U>
+        friend class arena_allocator;
+
+        json_arena* arena_;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        using is_always_equal = std::false_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = arena_allocator<U>;
+        };
+
+        arena_allocator() = delete;
+
+        arena_allocator(json_arena& arena) noexcept
+            : arena_(std::addressof(arena))
+        {
+        }
+
+        arena_allocator(const arena_allocator&) noexcept = default;
+
+        template <typename U>
+        arena_allocator(const arena_allocator<U>& other) noexcept
+            : arena_(other.arena_)
+        {
+        }
+
+        arena_allocator& operator=(const arena_allocator&) noexcept = default;
+
+        T* allocate(std::size_t n)
+        {
+            if (n > static_cast<std::size_t>(-1) / sizeof(T))
+            {
+                JSONCONS_THROW(std::bad_alloc());
+            }
+            return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            arena_->deallocate(p, n*sizeof(T));
+        }
+
+        json_arena& arena() const noexcept
+        {
+            return *arena_;
+        }
+
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.arena_;
+        }
+
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.arena_;
+        }
+    };
+
+    // Allocators whose memory is reclaimed all at once, so that a basic_json using one need not
+    // visit and free its nodes one by one when it is destroyed. May be specialized for other
+    // allocators with the same property.
+
+    template <typename Allocator>
+    struct is_monotonic_allocator : std::false_type {};
+
+    template <typename T>
+    struct is_monotonic_allocator<arena_allocator<T>> : std::true_type {};
+
+    template <typename T>
+    struct is_monotonic_allocator<std::scoped_allocator_adaptor<arena_allocator<T>>> : std::true_type {};
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_ARENA_HPP
@@ -0,0 +1,172 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_COMPACT_HPP
+#define JSONCONS_JSON_COMPACT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator_traits
+#include <scoped_allocator>
+#include <string>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_arena.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/utility/heap_string.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Upper bound on the bytes that copying source into a document of type Json allocates,
+    // allowing for the alignment padding of every allocation. Does not account for auxiliary
+    // structures such as the hash index of large ordered objects.
+    template <typename Json,typename Source>
+    std::size_t compact_size(const Source& source)
+    {
+        using char_type = typename Json::char_type;
+        using allocator_type = typename Json::allocator_type;
+        using string_storage_type = typename heap::heap_string_factory<char_type,null_type,allocator_type>::storage_type;
+        using bytes_storage_type = typename heap::heap_string_factory<uint8_t,uint64_t,allocator_type>::storage_type;
+        using key_value_type = typename Json::object::value_type;
+
+        constexpr std::size_t slack = alignof(std::max_align_t);
+        const std::size_t key_capacity = std::basic_string<char_type>().capacity();
+
+        std::size_t size = 0;
+        std::vector<const Source*> stack;
+        stack.push_back(std::addressof(source));
+        while (!stack.empty())
+        {
+            const Source* current = stack.back();
+            stack.pop_back();
+            if (current->is_raw_json())
+            {
+                size += sizeof(string_storage_type) + current->as_raw_json().size()*sizeof(char_type) + slack;
+                continue;
+            }
+            switch (current->type())
+            {
+                case json_type::string:
+                {
+                    const std::size_t length = current->as_string_view().size();
+                    if (length > Json::short_string_storage::max_length)
+                    {
+                        size += sizeof(string_storage_type) + length*sizeof(char_type) + slack;
+                    }
+                    break;
+                }
+                case json_type::byte_string:
+                    size += sizeof(bytes_storage_type) + current->as_byte_string_view().size() + slack;
+                    break;
+                case json_type::array:
+                    size += sizeof(typename Json::array) + current->size()*sizeof(Json) + 2*slack;
+                    for (const auto& item : current->array_range())
+                    {
+                        stack.push_back(std::addressof(item));
+                    }
+                    break;
+                case json_type::object:
+                    size += sizeof(typename Json::object) + current->size()*sizeof(key_value_type) + 2*slack;
+                    for (const auto& member : current->object_range())
+                    {
+                        if (member.key().size() > key_capacity)
+                        {
+                            size += (member.key().size() + 1)*sizeof(char_type) + slack;
+                        }
+                        stack.push_back(std::addressof(member.value()));
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        return size;
+    }
+
+    // Copies source depth first, giving every array and object the exact capacity it needs
+    template <typename Json,typename Source>
+    Json compact_copy_of(const Source& source, const typename Json::allocator_type& alloc)
+    {
+        if (source.is_raw_json())
+        {
+            return Json(raw_json_arg, source.as_raw_json(), alloc);
+        }
+        switch (source.type())
+        {
+            case json_type::null:
+                return Json(null_type(), source.tag());
+            case json_type::boolean:
+                return Json(source.as_bool(), source.tag());
+            case json_type::int64:
+                return Json(source.template as<int64_t>(), source.tag());
+            case json_type::uint64:
+                return Json(source.template as<uint64_t>(), source.tag());
+            case json_type::float16:
+                if (source.storage_kind() == json_storage_kind::half_float)
+                {
+                    return Json(half_arg, source.template cast<typename Source::half_storage>().value(), source.tag());
+                }
+                // A reference to a half precision value, widened
+                return Json(source.as_double(), source.tag());
+            case json_type::float64:
+                return Json(source.as_double(), source.tag());
+            case json_type::string:
+                return Json(source.as_string_view(), source.tag(), alloc);
+            case json_type::byte_string:
+                if (source.tag() == semantic_tag::ext)
+                {
+                    return Json(byte_string_arg, source.as_byte_string_view(), source.ext_tag(), alloc);
+                }
+                return Json(byte_string_arg, source.as_byte_string_view(), source.tag(), alloc);
+            case json_type::object:
+            {
+                Json result(json_object_arg, source.tag(), alloc);
+                result.reserve(source.size());
+                for (const auto& member : source.object_range())
+                {
+                    result.try_emplace(typename Json::string_view_type(member.key().data(), member.key().size()),
+                        compact_copy_of<Json>(member.value(), alloc));
+                }
+                return result;
+            }
+            case json_type::array:
+            {
+                Json result(json_array_arg, source.tag(), alloc);
+                result.reserve(source.size());
+                for (const auto& item : source.array_range())
+                {
+                    result.push_back(compact_copy_of<Json>(item, alloc));
+                }
+                return result;
+            }
+            default:
+                JSONCONS_UNREACHABLE();
+        }
+    }
+
+} // namespace detail
+
+    // Copies a finished document into arena, after reserving one chunk large enough for all of it.
+    // The copy is laid out depth first, with no spare capacity in its arrays and objects, which
+    // suits documents that are kept for a long time and mostly read. The arena must outlive the
+    // copy.
+    template <typename CharT,typename Policy,typename Allocator>
+    basic_json<CharT,Policy,std::scoped_allocator_adaptor<arena_allocator<char>>>
+    compact_copy(const basic_json<CharT,Policy,Allocator>& j, json_arena& arena)
+    {
+        using result_type = basic_json<CharT,Policy,std::scoped_allocator_adaptor<arena_allocator<char>>>;
+
+        arena.reserve(detail::compact_size<result_type>(j));
+        typename result_type::allocator_type alloc(arena);
+        return detail::compact_copy_of<result_type>(j, alloc);
+    }
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_COMPACT_HPP
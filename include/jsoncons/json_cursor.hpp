@@ -251,6 +251,34 @@ public:
         initialize_with_string_view(std::forward<Sourceable>(source), ec);
     }
     
+    // Constructors that parse a mutable buffer in place (see basic_json_parser::update_in_place). 
+    // The string views of string and key events point into data and remain valid after the
+    // cursor has moved on, for as long as data does.
+    basic_json_cursor(in_place_arg_t, CharT* data, std::size_t length,
+        const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>(),
+        const Allocator& alloc = Allocator())
+       : source_(),
+         parser_(options, alloc)
+    {
+        parser_.cursor_mode(true);
+        std::error_code ec;
+        initialize_in_place(data, length, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, 1, 1));
+        }
+    }
+
+    basic_json_cursor(in_place_arg_t, CharT* data, std::size_t length,
+        const basic_json_decode_options<CharT>& options,
+        std::error_code& ec)
+       : source_(),
+         parser_(options)
+    {
+        parser_.cursor_mode(true);
+        initialize_in_place(data, length, ec);
+    }
+
     basic_json_cursor(const basic_json_cursor&) = delete;
     basic_json_cursor(basic_json_cursor&&) = default;
     
@@ -491,6 +519,24 @@ private:
         }
         std::size_t offset = (r.ptr - sv.data());
         parser_.update(sv.data()+offset,sv.size()-offset);
+        read_first(ec);
+    }
+
+    void initialize_in_place(CharT* data, std::size_t length, std::error_code& ec)
+    {
+        auto r = unicode_traits::detect_json_encoding(data, length);
+        if (!(r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+        {
+            ec = json_errc::illegal_unicode_character;
+            return;
+        }
+        std::size_t offset = (r.ptr - data);
+        parser_.update_in_place(data+offset,length-offset);
+        read_first(ec);
+    }
+
+    void read_first(std::error_code& ec)
+    {
         bool read_done = parser_.done() || done_;
         if (!read_done)
         {
@@ -9,16 +9,21 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <memory> // std::allocator
 #include <system_error>
 #include <utility> // std::move
 #include <vector>
 
+#include <jsoncons/interned_key.hpp>
 #include <jsoncons/key_value.hpp>
 #include <jsoncons/json_type.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/packed_json_array.hpp>
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/ser_utils.hpp>
+#include <jsoncons/detail/span.hpp>
 
 namespace jsoncons {
 
@@ -55,6 +60,7 @@ private:
     };
 
     using temp_allocator_type = TempAlloc;
+    using packed_storage = std::integral_constant<bool,jsoncons::detail::has_packed_storage<array>::value>;
     using stack_item_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<index_key_value<Json>>;
     using json_structure_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<json_structure>;
  
@@ -64,6 +70,7 @@ private:
 
     std::size_t index_{0};
     key_type name_;
+    jsoncons::detail::key_interner<key_type,temp_allocator_type> key_interner_;
     std::vector<index_key_value<Json>,stack_item_allocator_type> item_stack_;
     std::vector<json_structure,json_structure_allocator_type> structure_stack_;
     bool is_valid_{false};
@@ -74,6 +81,7 @@ public:
         : alloc_(alloc),
           result_(),
           name_(alloc),
+          key_interner_(temp_alloc),
           item_stack_(alloc),
           structure_stack_(temp_alloc)
     {
@@ -87,6 +95,7 @@ public:
         : alloc_(),
           result_(),
           name_(),
+          key_interner_(temp_alloc),
           item_stack_(),
           structure_stack_(temp_alloc)
     {
@@ -195,12 +204,15 @@ private:
 
         if (size > 0)
         {
-            arr.reserve(size);
             auto first = item_stack_.begin() + (structure_index+1);
-            auto last = first + size;
-            for (auto it = first; it != last; ++it)
+            if (!jsoncons::detail::try_pack_array(arr, &item_stack_[structure_index+1], size))
             {
-                arr.push_back(std::move((*it).value));
+                arr.reserve(size);
+                auto last = first + size;
+                for (auto it = first; it != last; ++it)
+                {
+                    arr.push_back(std::move((*it).value));
+                }
             }
             item_stack_.erase(first, item_stack_.end());
         }
@@ -218,7 +230,7 @@ private:
 
     JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) final
     {
-        name_ = key_type(name.data(),name.length(),alloc_);
+        name_ = key_interner_.make_key(name, alloc_);
         JSONCONS_VISITOR_RETURN;
     }
 
@@ -367,6 +379,191 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint8_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint16_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint32_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const uint64_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int8_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int16_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int32_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const int64_t>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(half_arg_t, 
+        const jsoncons::span<const uint16_t>& s, 
+        semantic_tag tag, 
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        if (s.size() >= packed_size_threshold(packed_storage()))
+        {
+            Json j(json_array_arg, tag, alloc_);
+            pack(packed_storage(), j, half_arg, s);
+            add_value(std::move(j));
+            JSONCONS_VISITOR_RETURN;
+        }
+        this->begin_array(s.size(), tag, context, ec);
+        for (auto p = s.begin(); p != s.end(); ++p)
+        {
+            this->half_value(*p, semantic_tag::none, context, ec);
+        }
+        this->end_array(context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const float>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_typed_array(const jsoncons::span<const double>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec) final
+    {
+        return visit_packed(s, tag, context, ec);
+    }
+
+    // Typed arrays are kept packed if the array type supports it, otherwise they are
+    // expanded into elements
+    template <typename T>
+    JSONCONS_VISITOR_RETURN_TYPE visit_packed(const jsoncons::span<const T>& s, 
+        semantic_tag tag,
+        const ser_context& context, 
+        std::error_code& ec)
+    {
+        if (s.size() >= packed_size_threshold(packed_storage()))
+        {
+            Json j(json_array_arg, tag, alloc_);
+            pack(packed_storage(), j, s);
+            add_value(std::move(j));
+            JSONCONS_VISITOR_RETURN;
+        }
+        this->begin_array(s.size(), tag, context, ec);
+        for (auto p = s.begin(); p != s.end(); ++p)
+        {
+            typed_array_value(*p, context, ec);
+        }
+        this->end_array(context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+    typed_array_value(T value, const ser_context& context, std::error_code& ec)
+    {
+        this->int64_value(value, semantic_tag::none, context, ec);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+    typed_array_value(T value, const ser_context& context, std::error_code& ec)
+    {
+        this->uint64_value(value, semantic_tag::none, context, ec);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    typed_array_value(T value, const ser_context& context, std::error_code& ec)
+    {
+        this->double_value(value, semantic_tag::none, context, ec);
+    }
+
+    static constexpr std::size_t packed_size_threshold(std::true_type) noexcept
+    {
+        return array::min_packed_size;
+    }
+
+    static constexpr std::size_t packed_size_threshold(std::false_type) noexcept
+    {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    template <typename... Args>
+    static void pack(std::true_type, Json& j, Args&&... args)
+    {
+        j.template cast<typename Json::array_storage>().value().assign_packed(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    static void pack(std::false_type, Json&, Args&&...)
+    {
+    }
+
+    void add_value(Json&& j)
+    {
+        switch (structure_stack_.back().structure_kind)
+        {
+            case json_structure_kind::object_kind:
+                item_stack_.emplace_back(std::move(name_), index_++, std::move(j));
+                break;
+            case json_structure_kind::array_kind:
+                item_stack_.emplace_back(key_type(alloc_), 0, std::move(j));
+                break;
+            case json_structure_kind::root_kind:
+                result_ = std::move(j);
+                is_valid_ = true;
+                break;
+        }
+    }
+
     JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) final
     {
         switch (structure_stack_.back().structure_kind)
@@ -282,6 +282,11 @@ namespace jsoncons {
             reset();
         }
 
+        bool accepts_raw_json() const noexcept final
+        {
+            return true;
+        }
+
     private:
         // Implementing methods
         void visit_flush() final
@@ -552,6 +557,27 @@ namespace jsoncons {
             JSONCONS_VISITOR_RETURN;
         }
 
+        JSONCONS_VISITOR_RETURN_TYPE visit_raw_json(const string_view_type& text, const ser_context&, std::error_code&) final
+        {
+            if (!stack_.empty()) 
+            {
+                if (stack_.back().is_array())
+                {
+                    begin_scalar_value();
+                }
+                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                {
+                    break_line();
+                }
+            }
+
+            sink_.append(text.data(), text.size());
+            column_ += text.size();
+
+            end_value();
+            JSONCONS_VISITOR_RETURN;
+        }
+
         void write_string(const string_view_type& sv, semantic_tag tag, const ser_context&, std::error_code&) 
         {
             if (JSONCONS_LIKELY(tag == semantic_tag::noesc && !options_.escape_all_non_ascii() && !options_.escape_solidus()))
@@ -1082,6 +1108,11 @@ namespace jsoncons {
             reset();
         }
 
+        bool accepts_raw_json() const noexcept final
+        {
+            return true;
+        }
+
     private:
         // Implementing methods
         void visit_flush() final
@@ -1259,6 +1290,22 @@ namespace jsoncons {
             JSONCONS_VISITOR_RETURN;
         }
 
+        JSONCONS_VISITOR_RETURN_TYPE visit_raw_json(const string_view_type& text, const ser_context&, std::error_code&) final
+        {
+            if (!stack_.empty() && stack_.back().is_array() && stack_.back().count() > 0)
+            {
+                sink_.push_back(',');
+            }
+
+            sink_.append(text.data(), text.size());
+
+            if (!stack_.empty())
+            {
+                stack_.back().increment_count();
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
         void write_string(const string_view_type& sv, semantic_tag tag, const ser_context&, std::error_code&) 
         {
             if (JSONCONS_LIKELY(tag == semantic_tag::noesc && !options_.escape_all_non_ascii() && !options_.escape_solidus()))
@@ -7,8 +7,12 @@
 #ifndef JSONCONS_JSON_ENCODERS_HPP 
 #define JSONCONS_JSON_ENCODERS_HPP 
 
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
+#include <type_traits>
 
+#include <jsoncons/detail/simd.hpp>
 #include <jsoncons/json_options.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/ser_utils.hpp>
@@ -28,8 +32,9 @@ bool is_non_ascii_codepoint(uint32_t cp)
 {
     return cp >= 0x80;
 }
+// Escapes one code unit at a time, for wide characters
 template <typename CharT,typename Sink>
-std::size_t escape_string(const CharT* s, std::size_t length,
+std::size_t escape_string(std::false_type, const CharT* s, std::size_t length,
     bool escape_all_non_ascii, bool escape_solidus,
     Sink& sink)
 {
@@ -143,6 +148,123 @@ std::size_t escape_string(const CharT* s, std::size_t length,
     return count;
 }
 
+// The character that follows the backslash in the two character escape for c, or 0
+inline
+char short_escape_character(uint8_t c)
+{
+    static const char table[128] = {
+        0,  0,  0,  0,  0,  0,  0,  0,  'b','t','n',0,  'f','r',0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  '"',0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  '/',
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  '\\',0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+    };
+    return c < 0x80 ? table[c] : 0;
+}
+
+template <typename CharT,typename Sink>
+std::size_t write_unicode_escape(uint32_t cp, Sink& sink)
+{
+    CharT buf[12];
+    std::size_t n = 0;
+    auto put = [&](uint32_t u)
+    {
+        buf[n++] = '\\';
+        buf[n++] = 'u';
+        buf[n++] = jsoncons::to_hex_character(u >> 12 & 0x000F);
+        buf[n++] = jsoncons::to_hex_character(u >> 8 & 0x000F);
+        buf[n++] = jsoncons::to_hex_character(u >> 4 & 0x000F);
+        buf[n++] = jsoncons::to_hex_character(u & 0x000F);
+    };
+    if (cp > 0xFFFF)
+    {
+        cp -= 0x10000;
+        put((cp >> 10) + 0xD800);
+        put((cp & 0x03FF) + 0xDC00);
+    }
+    else
+    {
+        put(cp);
+    }
+    sink.append(buf, n);
+    return n;
+}
+
+// Appends each run of characters that need no escaping with one call, finding the end of
+// the run with the SIMD escape scanner
+template <bool EscapeNonAscii,bool EscapeSolidus,typename CharT,typename Sink>
+std::size_t escape_string_runs(const CharT* s, std::size_t length, Sink& sink)
+{
+    std::size_t count = 0;
+    const char* p = reinterpret_cast<const char*>(s);
+    const char* last = p + length;
+    while (p != last)
+    {
+        const char* q = simd::find_escape_special<EscapeNonAscii,EscapeSolidus>(p, last);
+        if (q != p)
+        {
+            sink.append(reinterpret_cast<const CharT*>(p), static_cast<std::size_t>(q - p));
+            count += static_cast<std::size_t>(q - p);
+            if (q == last)
+            {
+                break;
+            }
+        }
+        const auto c = static_cast<uint8_t>(*q);
+        const char esc = short_escape_character(c);
+        if (esc != 0)
+        {
+            sink.push_back('\\');
+            sink.push_back(esc);
+            count += 2;
+            p = q + 1;
+        }
+        else if (c < 0x80)
+        {
+            count += write_unicode_escape<CharT>(c, sink);
+            p = q + 1;
+        }
+        else
+        {
+            uint32_t cp;
+            auto r = unicode_traits::to_codepoint(q, last, cp, unicode_traits::strict_flag::strict);
+            if (r.ec != unicode_traits::unicode_errc())
+            {
+                JSONCONS_THROW(ser_error(json_errc::illegal_codepoint));
+            }
+            count += write_unicode_escape<CharT>(cp, sink);
+            p = r.ptr;
+        }
+    }
+    return count;
+}
+
+template <typename CharT,typename Sink>
+std::size_t escape_string(std::true_type, const CharT* s, std::size_t length,
+    bool escape_all_non_ascii, bool escape_solidus,
+    Sink& sink)
+{
+    if (escape_all_non_ascii)
+    {
+        return escape_solidus ? escape_string_runs<true,true>(s, length, sink)
+                              : escape_string_runs<true,false>(s, length, sink);
+    }
+    return escape_solidus ? escape_string_runs<false,true>(s, length, sink)
+                          : escape_string_runs<false,false>(s, length, sink);
+}
+
+template <typename CharT,typename Sink>
+std::size_t escape_string(const CharT* s, std::size_t length,
+    bool escape_all_non_ascii, bool escape_solidus,
+    Sink& sink)
+{
+    return escape_string(std::integral_constant<bool,sizeof(CharT) == sizeof(char)>(), s, length,
+        escape_all_non_ascii, escape_solidus, sink);
+}
+
 inline
 byte_string_chars_format resolve_byte_string_chars_format(byte_string_chars_format format1,
     byte_string_chars_format format2,
@@ -48,7 +48,8 @@ namespace jsoncons {
         illegal_surrogate_value,
         unpaired_high_surrogate,
         illegal_unicode_character,
-        unexpected_character
+        unexpected_character,
+        unexpected_raw_json
     };
 
     class json_error_category_impl
@@ -125,6 +126,8 @@ namespace jsoncons {
                     return "Illegal unicode character";
                 case json_errc::unexpected_character:
                     return "Unexpected character";
+                case json_errc::unexpected_raw_json:
+                    return "Raw JSON text not accepted by this visitor";
                 default:
                     return "Unknown JSON parser error";
                 }
@@ -43,6 +43,11 @@ public:
         return *destination_;
     }
 
+    bool accepts_raw_json() const noexcept override
+    {
+        return destination_->accepts_raw_json();
+    }
+
 private:
     void visit_flush() override
     {
@@ -102,6 +107,14 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    JSONCONS_VISITOR_RETURN_TYPE visit_raw_json(const string_view_type& text,
+        const ser_context& context,
+        std::error_code& ec) override
+    {
+        destination_->raw_json_value(text, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
     JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b, 
         semantic_tag tag,
         const ser_context& context,
@@ -294,6 +307,11 @@ public:
         return *destination1_;
     }
 
+    bool accepts_raw_json() const noexcept override
+    {
+        return destination1_->accepts_raw_json() && destination2_->accepts_raw_json();
+    }
+
 private:
     void visit_flush() override
     {
@@ -394,6 +412,19 @@ private:
         JSONCONS_VISITOR_RETURN;
     }
 
+    JSONCONS_VISITOR_RETURN_TYPE visit_raw_json(const string_view_type& text,
+        const ser_context& context,
+        std::error_code& ec) override
+    {
+        destination1_->raw_json_value(text, context, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_VISITOR_RETURN;
+        }
+        destination2_->raw_json_value(text, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
     JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b, 
         semantic_tag tag,
         const ser_context& context,
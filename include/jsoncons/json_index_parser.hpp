@@ -0,0 +1,908 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_INDEX_PARSER_HPP
+#define JSONCONS_JSON_INDEX_PARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/simd.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/read_number.hpp>
+#include <jsoncons/utility/unicode_traits.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // Marks the characters escaped by a backslash, carrying an unfinished backslash run
+    // into the next block (after simdjson's odd backslash sequence algorithm)
+    inline uint64_t find_escaped(uint64_t backslashes, uint64_t& prev_escaped) noexcept
+    {
+        constexpr uint64_t even_bits = 0x5555555555555555ull;
+
+        backslashes &= ~prev_escaped;
+        const uint64_t follows_escape = (backslashes << 1) | prev_escaped;
+        const uint64_t odd_sequence_starts = backslashes & ~even_bits & ~follows_escape;
+        const uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslashes;
+        prev_escaped = sequences_starting_on_even_bits < odd_sequence_starts ? 1 : 0;
+        const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+        return (even_bits ^ invert_mask) & follows_escape;
+    }
+
+    // Bit i of the result is the xor of bits 0..i of x
+    inline uint64_t prefix_xor(uint64_t x) noexcept
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+} // namespace detail
+
+// basic_json_index_parser parses JSON text that is entirely in memory in two stages. The first
+// stage classifies the input in 64 byte blocks and records the offsets of the structural
+// characters, the opening quotes of strings, and the first bytes of numbers and literals. The
+// second stage walks that index and reports the same events to a basic_json_visitor as
+// basic_json_parser.
+//
+// It accepts strict JSON only. Comments, trailing commas and other input that the streaming
+// parser would report to its error handler are returned as errors, so callers can reparse
+// with basic_json_parser to apply the usual recovery rules. Only narrow (UTF-8) text is
+// supported, and inputs are limited to 4 GB.
+
+template <typename CharT,typename TempAlloc = std::allocator<char>>
+class basic_json_index_parser : public ser_context
+{
+    static_assert(sizeof(CharT) == sizeof(char), "basic_json_index_parser requires UTF-8 input");
+public:
+    using char_type = CharT;
+    using string_view_type = typename basic_json_visitor<CharT>::string_view_type;
+private:
+    using char_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<CharT>;
+    using index_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<uint32_t>;
+    using uint8_allocator_type = typename std::allocator_traits<TempAlloc>:: template rebind_alloc<uint8_t>;
+
+    enum class container_kind : uint8_t {array, object};
+
+    enum class index_state : uint8_t
+    {
+        value,
+        value_or_end,
+        member_name,
+        member_name_or_end,
+        colon,
+        comma_or_end,
+        done
+    };
+
+    int max_nesting_depth_;
+    bool lossless_number_;
+    bool lossless_bignum_;
+    bool lazy_numbers_;
+    bool enable_str_to_inf_;
+    bool enable_str_to_neginf_;
+    bool enable_str_to_nan_;
+    std::basic_string<char_type> inf_to_str_;
+    std::basic_string<char_type> neginf_to_str_;
+    std::basic_string<char_type> nan_to_str_;
+
+    const char_type* data_{nullptr};
+    std::size_t length_{0};
+    std::size_t begin_position_{0};
+    std::size_t end_position_{0};
+
+    // line and column are computed on demand, scanning forward from the last request
+    mutable std::size_t line_scan_pos_{0};
+    mutable std::size_t line_{1};
+    mutable std::size_t line_start_{0};
+
+    std::vector<uint32_t,index_allocator_type> index_;
+    std::vector<container_kind,typename std::allocator_traits<TempAlloc>:: template rebind_alloc<container_kind>> stack_;
+    std::basic_string<char_type,std::char_traits<char_type>,char_allocator_type> buffer_;
+
+    // Noncopyable and nonmoveable
+    basic_json_index_parser(const basic_json_index_parser&) = delete;
+    basic_json_index_parser& operator=(const basic_json_index_parser&) = delete;
+
+public:
+    basic_json_index_parser()
+        : basic_json_index_parser(basic_json_decode_options<char_type>())
+    {
+    }
+
+    explicit basic_json_index_parser(const TempAlloc& temp_alloc)
+        : basic_json_index_parser(basic_json_decode_options<char_type>(), temp_alloc)
+    {
+    }
+
+    basic_json_index_parser(const basic_json_decode_options<char_type>& options,
+        const TempAlloc& temp_alloc = TempAlloc())
+       : max_nesting_depth_(options.max_nesting_depth()),
+         lossless_number_(options.lossless_number()),
+         lossless_bignum_(options.lossless_bignum()),
+         lazy_numbers_(options.lazy_numbers()),
+         enable_str_to_inf_(options.enable_str_to_inf()),
+         enable_str_to_neginf_(options.enable_str_to_neginf()),
+         enable_str_to_nan_(options.enable_str_to_nan()),
+         inf_to_str_(options.inf_to_str()),
+         neginf_to_str_(options.neginf_to_str()),
+         nan_to_str_(options.nan_to_str()),
+         index_(temp_alloc),
+         stack_(temp_alloc),
+         buffer_(temp_alloc)
+    {
+    }
+
+    ~basic_json_index_parser() noexcept
+    {
+    }
+
+    static constexpr std::size_t max_length()
+    {
+        return (std::numeric_limits<uint32_t>::max)();
+    }
+
+    void parse(const char_type* data, std::size_t length, basic_json_visitor<char_type>& visitor)
+    {
+        std::error_code ec;
+        parse(data, length, visitor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void parse(const char_type* data, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        data_ = data;
+        length_ = length;
+        begin_position_ = 0;
+        end_position_ = 0;
+        line_scan_pos_ = 0;
+        line_ = 1;
+        line_start_ = 0;
+
+        if (JSONCONS_UNLIKELY(length > max_length()))
+        {
+            ec = json_errc::source_error;
+            return;
+        }
+        build_index(ec);
+        if (JSONCONS_UNLIKELY(ec)) {return;}
+        walk_index(visitor, ec);
+    }
+
+    std::size_t line() const final
+    {
+        advance_line_scan();
+        return line_;
+    }
+
+    std::size_t column() const final
+    {
+        advance_line_scan();
+        return (end_position_ - line_start_) + 1;
+    }
+
+    std::size_t begin_position() const final
+    {
+        return begin_position_;
+    }
+
+    std::size_t position() const final
+    {
+        return begin_position_;
+    }
+
+    std::size_t end_position() const final
+    {
+        return end_position_;
+    }
+
+private:
+
+    void advance_line_scan() const
+    {
+        if (end_position_ < line_scan_pos_)
+        {
+            line_scan_pos_ = 0;
+            line_ = 1;
+            line_start_ = 0;
+        }
+        for (; line_scan_pos_ < end_position_ && line_scan_pos_ < length_; ++line_scan_pos_)
+        {
+            const char_type c = data_[line_scan_pos_];
+            if (c == '\n' || (c == '\r' && (line_scan_pos_ + 1 >= length_ || data_[line_scan_pos_ + 1] != '\n')))
+            {
+                ++line_;
+                line_start_ = line_scan_pos_ + 1;
+            }
+        }
+    }
+
+    // Stage 1
+
+    void build_index(std::error_code& ec)
+    {
+        index_.clear();
+        index_.reserve(length_ / 8 + 16);
+
+        const char* p = reinterpret_cast<const char*>(data_);
+        uint64_t prev_escaped = 0;
+        uint64_t prev_in_string = 0;
+        uint64_t prev_scalar = 0;
+
+        char padded[64];
+        for (std::size_t offset = 0; offset < length_; offset += 64)
+        {
+            const char* block = p + offset;
+            if (length_ - offset < 64)
+            {
+                std::memset(padded, ' ', sizeof(padded));
+                std::memcpy(padded, block, length_ - offset);
+                block = padded;
+            }
+            const auto cls = detail::simd::classify_block(block);
+
+            const uint64_t escaped = detail::find_escaped(cls.backslashes, prev_escaped);
+            const uint64_t quotes = cls.quotes & ~escaped;
+            const uint64_t in_string = detail::prefix_xor(quotes) ^ prev_in_string;
+            prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+            const uint64_t scalar = ~(cls.ops | cls.spaces | quotes | in_string);
+            const uint64_t scalar_starts = scalar & ~((scalar << 1) | prev_scalar);
+            prev_scalar = scalar >> 63;
+
+            uint64_t structurals = (cls.ops & ~in_string) | (quotes & in_string) | scalar_starts;
+            while (structurals != 0)
+            {
+                index_.push_back(static_cast<uint32_t>(offset + detail::simd::ctz64(structurals)));
+                structurals &= structurals - 1;
+            }
+        }
+        if (prev_in_string != 0)
+        {
+            end_position_ = length_;
+            ec = json_errc::unexpected_eof;
+            return;
+        }
+    }
+
+    // Stage 2
+
+    void walk_index(basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        stack_.clear();
+        index_state state = index_state::value;
+
+        const std::size_t count = index_.size();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t pos = index_[i];
+            const char_type c = data_[pos];
+            begin_position_ = pos;
+            end_position_ = pos;
+
+            switch (state)
+            {
+                case index_state::value_or_end:
+                    if (c == ']')
+                    {
+                        end_position_ = pos + 1;
+                        stack_.pop_back();
+                        visitor.end_array(*this, ec);
+                        if (JSONCONS_UNLIKELY(ec)) {return;}
+                        state = after_value();
+                        break;
+                    }
+                    JSONCONS_FALLTHROUGH;
+                case index_state::value:
+                    switch (c)
+                    {
+                        case '{':
+                            end_position_ = pos + 1;
+                            if (JSONCONS_UNLIKELY(stack_.size() >= static_cast<std::size_t>(max_nesting_depth_)))
+                            {
+                                ec = json_errc::max_nesting_depth_exceeded;
+                                return;
+                            }
+                            stack_.push_back(container_kind::object);
+                            visitor.begin_object(semantic_tag::none, *this, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            state = index_state::member_name_or_end;
+                            break;
+                        case '[':
+                            end_position_ = pos + 1;
+                            if (JSONCONS_UNLIKELY(stack_.size() >= static_cast<std::size_t>(max_nesting_depth_)))
+                            {
+                                ec = json_errc::max_nesting_depth_exceeded;
+                                return;
+                            }
+                            stack_.push_back(container_kind::array);
+                            visitor.begin_array(semantic_tag::none, *this, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            state = index_state::value_or_end;
+                            break;
+                        case '\"':
+                            parse_string(pos, false, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            state = after_value();
+                            break;
+                        case '}':
+                            ec = json_errc::unexpected_rbrace;
+                            return;
+                        case ']':
+                            ec = json_errc::unexpected_rbracket;
+                            return;
+                        case ',': case ':':
+                            ec = json_errc::expected_value;
+                            return;
+                        default:
+                        {
+                            const std::size_t next = (i + 1 < count) ? index_[i+1] : length_;
+                            parse_scalar(pos, next, visitor, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            state = after_value();
+                            break;
+                        }
+                    }
+                    break;
+                case index_state::member_name_or_end:
+                    if (c == '}')
+                    {
+                        end_position_ = pos + 1;
+                        stack_.pop_back();
+                        visitor.end_object(*this, ec);
+                        if (JSONCONS_UNLIKELY(ec)) {return;}
+                        state = after_value();
+                        break;
+                    }
+                    JSONCONS_FALLTHROUGH;
+                case index_state::member_name:
+                    if (JSONCONS_UNLIKELY(c != '\"'))
+                    {
+                        ec = c == '}' ? json_errc::extra_comma : json_errc::expected_key;
+                        return;
+                    }
+                    parse_string(pos, true, visitor, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return;}
+                    state = index_state::colon;
+                    break;
+                case index_state::colon:
+                    if (JSONCONS_UNLIKELY(c != ':'))
+                    {
+                        ec = json_errc::expected_colon;
+                        return;
+                    }
+                    state = index_state::value;
+                    break;
+                case index_state::comma_or_end:
+                    switch (c)
+                    {
+                        case ',':
+                            state = stack_.back() == container_kind::object ? index_state::member_name : index_state::value;
+                            break;
+                        case '}':
+                            if (JSONCONS_UNLIKELY(stack_.back() != container_kind::object))
+                            {
+                                ec = json_errc::expected_comma_or_rbracket;
+                                return;
+                            }
+                            end_position_ = pos + 1;
+                            stack_.pop_back();
+                            visitor.end_object(*this, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            state = after_value();
+                            break;
+                        case ']':
+                            if (JSONCONS_UNLIKELY(stack_.back() != container_kind::array))
+                            {
+                                ec = json_errc::expected_comma_or_rbrace;
+                                return;
+                            }
+                            end_position_ = pos + 1;
+                            stack_.pop_back();
+                            visitor.end_array(*this, ec);
+                            if (JSONCONS_UNLIKELY(ec)) {return;}
+                            state = after_value();
+                            break;
+                        default:
+                            ec = stack_.back() == container_kind::object ? json_errc::expected_comma_or_rbrace : json_errc::expected_comma_or_rbracket;
+                            return;
+                    }
+                    break;
+                case index_state::done:
+                    ec = json_errc::extra_character;
+                    return;
+            }
+        }
+        if (JSONCONS_UNLIKELY(state != index_state::done))
+        {
+            end_position_ = length_;
+            ec = json_errc::unexpected_eof;
+            return;
+        }
+        visitor.flush();
+    }
+
+    index_state after_value() const
+    {
+        return stack_.empty() ? index_state::done : index_state::comma_or_end;
+    }
+
+    void parse_scalar(std::size_t pos, std::size_t next, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        std::size_t end = pos;
+        while (end < next && !is_space(data_[end]))
+        {
+            ++end;
+        }
+        end_position_ = end;
+        const char_type* s = data_ + pos;
+        const std::size_t length = end - pos;
+
+        switch (*s)
+        {
+            case 't':
+                if (JSONCONS_UNLIKELY(!is_literal(s, length, "true", 4)))
+                {
+                    ec = json_errc::invalid_value;
+                    return;
+                }
+                visitor.bool_value(true, semantic_tag::none, *this, ec);
+                return;
+            case 'f':
+                if (JSONCONS_UNLIKELY(!is_literal(s, length, "false", 5)))
+                {
+                    ec = json_errc::invalid_value;
+                    return;
+                }
+                visitor.bool_value(false, semantic_tag::none, *this, ec);
+                return;
+            case 'n':
+                if (JSONCONS_UNLIKELY(!is_literal(s, length, "null", 4)))
+                {
+                    ec = json_errc::invalid_value;
+                    return;
+                }
+                visitor.null_value(semantic_tag::none, *this, ec);
+                return;
+            case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+                parse_number(s, length, visitor, ec);
+                return;
+            default:
+                ec = json_errc::syntax_error;
+                return;
+        }
+    }
+
+    static bool is_space(char_type c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static bool is_literal(const char_type* s, std::size_t length, const char* literal, std::size_t literal_length)
+    {
+        return length == literal_length && std::memcmp(s, literal, literal_length) == 0;
+    }
+
+    void parse_number(const char_type* s, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        const char_type* cur = s;
+        const char_type* last = s + length;
+        bool is_integer = true;
+
+        if (*cur == '-')
+        {
+            ++cur;
+        }
+        if (cur == last)
+        {
+            ec = json_errc::invalid_number;
+            return;
+        }
+        if (*cur == '0')
+        {
+            ++cur;
+            if (cur < last && jsoncons::is_digit(*cur))
+            {
+                ec = json_errc::leading_zero;
+                return;
+            }
+        }
+        else if (jsoncons::is_digit(*cur))
+        {
+            while (cur < last && jsoncons::is_digit(*cur))
+            {
+                ++cur;
+            }
+        }
+        else
+        {
+            ec = json_errc::invalid_number;
+            return;
+        }
+        if (cur < last && *cur == '.')
+        {
+            is_integer = false;
+            ++cur;
+            if (cur == last || !jsoncons::is_digit(*cur))
+            {
+                ec = json_errc::invalid_number;
+                return;
+            }
+            while (cur < last && jsoncons::is_digit(*cur))
+            {
+                ++cur;
+            }
+        }
+        if (cur < last && (*cur == 'e' || *cur == 'E'))
+        {
+            is_integer = false;
+            ++cur;
+            if (cur < last && (*cur == '+' || *cur == '-'))
+            {
+                ++cur;
+            }
+            if (cur == last || !jsoncons::is_digit(*cur))
+            {
+                ec = json_errc::invalid_number;
+                return;
+            }
+            while (cur < last && jsoncons::is_digit(*cur))
+            {
+                ++cur;
+            }
+        }
+        if (cur != last)
+        {
+            ec = json_errc::invalid_number;
+            return;
+        }
+
+        if (is_integer)
+        {
+            end_integer_value(s, length, visitor, ec);
+        }
+        else
+        {
+            end_fraction_value(s, length, visitor, ec);
+        }
+    }
+
+    // Number conversions follow basic_json_parser
+
+    void end_integer_value(const char_type* s, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        if (lazy_numbers_)
+        {
+            visitor.string_value(string_view_type(s, length), semantic_tag::bigint, *this, ec);
+            return;
+        }
+        if (*s == '-')
+        {
+            int64_t val;
+            auto result = jsoncons::dec_to_integer(s, length, val);
+            if (result)
+            {
+                visitor.int64_value(val, semantic_tag::none, *this, ec);
+                return;
+            }
+        }
+        else
+        {
+            uint64_t val;
+            auto result = jsoncons::dec_to_integer(s, length, val);
+            if (result)
+            {
+                visitor.uint64_value(val, semantic_tag::none, *this, ec);
+                return;
+            }
+        }
+        // Must be overflow
+        if (lossless_bignum_)
+        {
+            visitor.string_value(string_view_type(s, length), semantic_tag::bigint, *this, ec);
+            return;
+        }
+        double d{0};
+        auto result = jsoncons::decstr_to_double(s, length, d);
+        if (JSONCONS_LIKELY(result) || result.ec == std::errc::result_out_of_range)
+        {
+            visitor.double_value(d, semantic_tag::none, *this, ec);
+            return;
+        }
+        ec = json_errc::invalid_number;
+    }
+
+    void end_fraction_value(const char_type* s, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        if (lossless_number_ || lazy_numbers_)
+        {
+            visitor.string_value(string_view_type(s, length), semantic_tag::bigdec, *this, ec);
+            return;
+        }
+        double d{0};
+        auto result = jsoncons::decstr_to_double(s, length, d);
+        if (JSONCONS_LIKELY(result))
+        {
+            visitor.double_value(d, semantic_tag::none, *this, ec);
+        }
+        else if (result.ec == std::errc::result_out_of_range)
+        {
+            if (lossless_bignum_)
+            {
+                visitor.string_value(string_view_type(s, length), semantic_tag::bigdec, *this, ec);
+            }
+            else
+            {
+                visitor.double_value(d, semantic_tag::none, *this, ec);
+            }
+        }
+        else
+        {
+            ec = json_errc::invalid_number;
+        }
+    }
+
+    void parse_string(std::size_t pos, bool is_key, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+    {
+        const char* first = reinterpret_cast<const char*>(data_);
+        const char* last = first + length_;
+        const char* cur = first + pos + 1;
+        const char* sb = cur;
+        bool escaped = false;
+
+        while (true)
+        {
+            cur = detail::simd::find_string_special(cur, last);
+            if (JSONCONS_UNLIKELY(cur == last))
+            {
+                end_position_ = length_;
+                ec = json_errc::unexpected_eof;
+                return;
+            }
+            const auto c = static_cast<uint8_t>(*cur);
+            if (c == '\"')
+            {
+                break;
+            }
+            if (c == '\\')
+            {
+                if (!escaped)
+                {
+                    buffer_.clear();
+                    escaped = true;
+                }
+                buffer_.append(reinterpret_cast<const char_type*>(sb), cur - sb);
+                cur = unescape(cur + 1, last, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return;}
+                sb = cur;
+            }
+            else if (c < 0x20)
+            {
+                end_position_ = static_cast<std::size_t>(cur - first);
+                ec = (c == '\n' || c == '\r' || c == '\t') ? json_errc::illegal_character_in_string : json_errc::illegal_control_character;
+                return;
+            }
+            else
+            {
+                const std::size_t len = static_cast<std::size_t>(unicode_traits::trailing_bytes_for_utf8[c]) + 1;
+                if (JSONCONS_UNLIKELY(len > static_cast<std::size_t>(last - cur)))
+                {
+                    end_position_ = static_cast<std::size_t>(cur - first);
+                    ec = json_errc::unexpected_eof;
+                    return;
+                }
+                auto result = unicode_traits::is_legal_utf8(reinterpret_cast<const uint8_t*>(cur), len);
+                if (JSONCONS_UNLIKELY(result != unicode_traits::unicode_errc()))
+                {
+                    end_position_ = static_cast<std::size_t>(cur - first);
+                    ec = translate_conv_errc(result);
+                    return;
+                }
+                cur += len;
+            }
+        }
+        end_position_ = static_cast<std::size_t>(cur - first) + 1;
+
+        string_view_type sv;
+        if (escaped)
+        {
+            buffer_.append(reinterpret_cast<const char_type*>(sb), cur - sb);
+            sv = string_view_type(buffer_.data(), buffer_.size());
+        }
+        else
+        {
+            sv = string_view_type(reinterpret_cast<const char_type*>(sb), cur - sb);
+        }
+
+        if (is_key)
+        {
+            visitor.key(sv, *this, ec);
+        }
+        else if (enable_str_to_inf_ && sv == inf_to_str_)
+        {
+            visitor.double_value(std::numeric_limits<double>::infinity(), semantic_tag::none, *this, ec);
+        }
+        else if (enable_str_to_neginf_ && sv == neginf_to_str_)
+        {
+            visitor.double_value(-std::numeric_limits<double>::infinity(), semantic_tag::none, *this, ec);
+        }
+        else if (enable_str_to_nan_ && sv == nan_to_str_)
+        {
+            visitor.double_value(std::numeric_limits<double>::quiet_NaN(), semantic_tag::none, *this, ec);
+        }
+        else
+        {
+            visitor.string_value(sv, escaped ? semantic_tag{} : semantic_tag::noesc, *this, ec);
+        }
+    }
+
+    static json_errc translate_conv_errc(unicode_traits::unicode_errc result)
+    {
+        switch (result)
+        {
+            case unicode_traits::unicode_errc::over_long_utf8_sequence:
+                return json_errc::over_long_utf8_sequence;
+            case unicode_traits::unicode_errc::unpaired_high_surrogate:
+                return json_errc::unpaired_high_surrogate;
+            case unicode_traits::unicode_errc::bad_continuation_byte:
+                return json_errc::bad_continuation_byte;
+            case unicode_traits::unicode_errc::illegal_surrogate_value:
+                return json_errc::illegal_surrogate_value;
+            default:
+                return json_errc::illegal_codepoint;
+        }
+    }
+
+    // Appends the character denoted by the escape sequence starting at cur (just after the
+    // backslash) to buffer_, and returns the position after the sequence
+    const char* unescape(const char* cur, const char* last, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(cur == last))
+        {
+            ec = json_errc::unexpected_eof;
+            return cur;
+        }
+        switch (*cur)
+        {
+            case '\"': buffer_.push_back('\"'); return cur + 1;
+            case '\\': buffer_.push_back('\\'); return cur + 1;
+            case '/': buffer_.push_back('/'); return cur + 1;
+            case 'b': buffer_.push_back('\b'); return cur + 1;
+            case 'f': buffer_.push_back('\f'); return cur + 1;
+            case 'n': buffer_.push_back('\n'); return cur + 1;
+            case 'r': buffer_.push_back('\r'); return cur + 1;
+            case 't': buffer_.push_back('\t'); return cur + 1;
+            case 'u':
+            {
+                uint32_t cp = 0;
+                cur = read_hex4(cur + 1, last, cp, ec);
+                if (JSONCONS_UNLIKELY(ec)) {return cur;}
+                if (unicode_traits::is_high_surrogate(cp))
+                {
+                    if (JSONCONS_UNLIKELY(last - cur < 2 || cur[0] != '\\' || cur[1] != 'u'))
+                    {
+                        ec = json_errc::expected_codepoint_surrogate_pair;
+                        return cur;
+                    }
+                    uint32_t cp2 = 0;
+                    cur = read_hex4(cur + 2, last, cp2, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return cur;}
+                    cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                }
+                unicode_traits::convert(&cp, 1, buffer_);
+                return cur;
+            }
+            default:
+                end_position_ = static_cast<std::size_t>(cur - reinterpret_cast<const char*>(data_));
+                ec = json_errc::illegal_escaped_character;
+                return cur;
+        }
+    }
+
+    static const char* read_hex4(const char* cur, const char* last, uint32_t& cp, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(last - cur < 4))
+        {
+            ec = json_errc::unexpected_eof;
+            return cur;
+        }
+        for (int i = 0; i < 4; ++i, ++cur)
+        {
+            const char c = *cur;
+            cp *= 16;
+            if (c >= '0' && c <= '9')
+            {
+                cp += c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                cp += c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                cp += c - 'A' + 10;
+            }
+            else
+            {
+                ec = json_errc::invalid_unicode_escape_sequence;
+                return cur;
+            }
+        }
+        return cur;
+    }
+};
+
+using json_index_parser = basic_json_index_parser<char>;
+
+namespace detail {
+
+    // Whether contiguous text of the given length should be parsed with basic_json_index_parser
+    template <typename CharT>
+    bool use_index_parser(const basic_json_decode_options<CharT>& options, std::size_t length)
+    {
+        JSONCONS_IF_CONSTEXPR (sizeof(CharT) != sizeof(char))
+        {
+            return false;
+        }
+        switch (options.parse_engine())
+        {
+            case parse_engine_kind::indexed:
+                return length <= basic_json_index_parser<char>::max_length();
+            case parse_engine_kind::automatic:
+                return length >= basic_json_decode_options<CharT>::indexed_parse_threshold &&
+                       length <= basic_json_index_parser<char>::max_length();
+            default:
+                return false;
+        }
+    }
+
+    // Parses with basic_json_index_parser into a fresh decoder, returning false on any error
+    // so that the caller can reparse with basic_json_parser
+
+    template <typename Decoder,typename CharT,typename TempAlloc>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),bool>::type
+    try_index_parse(Decoder& decoder, const CharT* data, std::size_t length,
+        const basic_json_decode_options<CharT>& options, const TempAlloc& temp_alloc)
+    {
+        std::error_code ec;
+        basic_json_index_parser<CharT,TempAlloc> parser(options, temp_alloc);
+        parser.parse(data, length, decoder, ec);
+        return !ec && decoder.is_valid();
+    }
+
+    template <typename Decoder,typename CharT,typename TempAlloc>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),bool>::type
+    try_index_parse(Decoder&, const CharT*, std::size_t,
+        const basic_json_decode_options<CharT>&, const TempAlloc&)
+    {
+        return false;
+    }
+
+} // namespace detail
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_INDEX_PARSER_HPP
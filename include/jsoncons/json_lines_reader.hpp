@@ -0,0 +1,529 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_READER_HPP
+#define JSONCONS_JSON_LINES_READER_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new> // std::bad_alloc
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/source.hpp>
+
+namespace jsoncons {
+
+    // Order in which json_lines_reader delivers records to the callback: input order, or
+    // batch by batch in the order the workers finish them
+    enum class lines_order : uint8_t {input, completion};
+
+    class json_lines_options
+    {
+        std::size_t num_threads_{0};
+        lines_order order_{lines_order::input};
+        std::size_t batch_size_{1 << 20};
+        std::size_t max_batches_in_flight_{0};
+    public:
+        json_lines_options() = default;
+
+        // Number of worker threads, 0 for std::thread::hardware_concurrency()
+        std::size_t num_threads() const
+        {
+            if (num_threads_ != 0)
+            {
+                return num_threads_;
+            }
+            std::size_t n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+        }
+
+        json_lines_options& num_threads(std::size_t value)
+        {
+            num_threads_ = value;
+            return *this;
+        }
+
+        lines_order order() const
+        {
+            return order_;
+        }
+
+        json_lines_options& order(lines_order value)
+        {
+            order_ = value;
+            return *this;
+        }
+
+        // Approximate number of bytes handed to a worker at a time. A batch always
+        // ends at a line break, so a line longer than this makes a larger batch.
+        std::size_t batch_size() const
+        {
+            return batch_size_;
+        }
+
+        json_lines_options& batch_size(std::size_t value)
+        {
+            batch_size_ = value == 0 ? 1 : value;
+            return *this;
+        }
+
+        // Upper bound on batches read but not yet delivered, which bounds memory.
+        // 0 for twice the number of threads.
+        std::size_t max_batches_in_flight() const
+        {
+            return max_batches_in_flight_ != 0 ? max_batches_in_flight_ : 2*num_threads();
+        }
+
+        json_lines_options& max_batches_in_flight(std::size_t value)
+        {
+            max_batches_in_flight_ = value;
+            return *this;
+        }
+    };
+
+    // Reads JSON Lines (newline delimited JSON) text, parsing the records on a pool
+    // of worker threads. Each worker has its own parser and decoder. Records are passed
+    // to the callback, with their line number, on the thread that calls read.
+
+    template <typename Json,typename Source=jsoncons::stream_source<char>,typename TempAlloc =std::allocator<char>>
+    class json_lines_reader : public ser_context
+    {
+    public:
+        using value_type = Json;
+        using char_type = typename Json::char_type;
+        using source_type = Source;
+
+        static_assert(sizeof(char_type) == sizeof(char), "json_lines_reader requires a narrow character type");
+    private:
+        struct batch
+        {
+            std::size_t seq;
+            std::size_t first_line;
+            std::string text;
+        };
+
+        struct batch_result
+        {
+            std::size_t seq{0};
+            std::vector<std::pair<std::size_t,Json>> records;
+            std::error_code ec;
+            std::size_t line{0};
+            std::size_t column{0};
+            std::exception_ptr exception;
+        };
+
+        // State shared between the calling thread and the workers
+        struct shared_state
+        {
+            std::mutex mutex;
+            std::condition_variable work_ready;
+            std::condition_variable result_ready;
+            std::deque<batch> work;
+            std::deque<batch_result> results;
+            bool done{false};
+        };
+
+        source_type source_;
+        basic_json_decode_options<char_type> options_;
+        json_lines_options lines_options_;
+        TempAlloc temp_alloc_;
+        std::string carry_;
+        std::size_t line_{0};
+        std::size_t column_{0};
+
+        // Noncopyable and nonmoveable
+        json_lines_reader(const json_lines_reader&) = delete;
+        json_lines_reader& operator=(const json_lines_reader&) = delete;
+    public:
+        template <typename Sourceable>
+        json_lines_reader(Sourceable&& source,
+            const json_lines_options& lines_options = json_lines_options{},
+            const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>{},
+            const TempAlloc& temp_alloc = TempAlloc())
+            : source_(std::forward<Sourceable>(source)),
+              options_(options),
+              lines_options_(lines_options),
+              temp_alloc_(temp_alloc)
+        {
+        }
+
+        std::size_t line() const override
+        {
+            return line_;
+        }
+
+        std::size_t column() const override
+        {
+            return column_;
+        }
+
+        // Callback is called as callback(std::size_t line, Json&& value)
+        template <typename Callback>
+        void read(Callback callback)
+        {
+            std::error_code ec;
+            std::exception_ptr exception;
+            read(callback, ec, exception);
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(ser_error(ec,line_,column_));
+            }
+        }
+
+        // An exception thrown by a worker, or by starting the workers, sets ec
+        template <typename Callback>
+        void read(Callback callback, std::error_code& ec)
+        {
+            std::exception_ptr exception;
+            read(callback, ec, exception);
+            if (exception)
+            {
+                ec = to_error_code(exception);
+            }
+        }
+
+    private:
+        template <typename Callback>
+        void read(Callback& callback, std::error_code& ec, std::exception_ptr& exception)
+        {
+            shared_state state;
+            worker_pool pool(state);
+            exception = pool.start(options_, temp_alloc_, lines_options_.num_threads());
+            if (exception)
+            {
+                return;
+            }
+
+            const std::size_t max_in_flight = lines_options_.max_batches_in_flight();
+            const bool in_order = lines_options_.order() == lines_order::input;
+
+            std::size_t next_seq = 0;
+            std::size_t next_line = 1;
+            std::size_t next_to_deliver = 0;
+            std::size_t in_flight = 0;
+            bool source_done = false;
+            std::map<std::size_t,batch_result> pending;
+
+            while (true)
+            {
+                while (!source_done && in_flight < max_in_flight)
+                {
+                    batch b{next_seq, next_line, std::string()};
+                    source_done = !next_batch(b.text, ec);
+                    if (JSONCONS_UNLIKELY(ec))
+                    {
+                        return;
+                    }
+                    if (b.text.empty())
+                    {
+                        break;
+                    }
+                    next_line += static_cast<std::size_t>(std::count(b.text.begin(), b.text.end(), '\n'));
+                    ++next_seq;
+                    ++in_flight;
+                    {
+                        std::lock_guard<std::mutex> lock(state.mutex);
+                        state.work.push_back(std::move(b));
+                    }
+                    state.work_ready.notify_one();
+                }
+                if (in_flight == 0)
+                {
+                    break;
+                }
+
+                std::deque<batch_result> completed;
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.result_ready.wait(lock, [&state]{return !state.results.empty();});
+                    completed.swap(state.results);
+                }
+
+                // Workers append results as they finish, so completed is in completion order
+                if (!in_order)
+                {
+                    for (auto& result : completed)
+                    {
+                        if (!deliver(result, callback, ec, exception))
+                        {
+                            return;
+                        }
+                        --in_flight;
+                    }
+                    continue;
+                }
+
+                for (auto& result : completed)
+                {
+                    pending.emplace(result.seq, std::move(result));
+                }
+                auto it = pending.find(next_to_deliver);
+                while (it != pending.end())
+                {
+                    if (!deliver(it->second, callback, ec, exception))
+                    {
+                        return;
+                    }
+                    pending.erase(it);
+                    --in_flight;
+                    ++next_to_deliver;
+                    it = pending.find(next_to_deliver);
+                }
+            }
+        }
+
+        // Passes the records of a batch to the callback. Returns false if the batch ended
+        // in an error.
+        template <typename Callback>
+        bool deliver(batch_result& result, Callback& callback, std::error_code& ec, std::exception_ptr& exception)
+        {
+            if (result.exception)
+            {
+                exception = result.exception;
+                return false;
+            }
+            for (auto& record : result.records)
+            {
+                callback(record.first, std::move(record.second));
+            }
+            if (result.ec)
+            {
+                ec = result.ec;
+                line_ = result.line;
+                column_ = result.column;
+                return false;
+            }
+            return true;
+        }
+
+        // Exceptions are only captured when they are enabled
+        std::error_code to_error_code(const std::exception_ptr& exception)
+        {
+#if !defined(JSONCONS_NO_EXCEPTIONS)
+            try
+            {
+                std::rethrow_exception(exception);
+            }
+            catch (const ser_error& e)
+            {
+                line_ = e.line();
+                column_ = e.column();
+                return e.code();
+            }
+            catch (const std::system_error& e)
+            {
+                return e.code();
+            }
+            catch (const std::bad_alloc&)
+            {
+                return std::make_error_code(std::errc::not_enough_memory);
+            }
+            catch (...)
+            {
+            }
+#else
+            (void)exception;
+#endif
+            return std::make_error_code(std::errc::state_not_recoverable);
+        }
+
+        // Fills text with whole lines of about batch_size bytes. Returns false when
+        // the source is exhausted.
+        bool next_batch(std::string& text, std::error_code& ec)
+        {
+            const std::size_t batch_size = lines_options_.batch_size();
+            text.swap(carry_);
+            carry_.clear();
+
+            while (true)
+            {
+                if (source_.is_error())
+                {
+                    ec = json_errc::source_error;
+                    return false;
+                }
+                const std::size_t old_size = text.size();
+                const std::size_t wanted = old_size < batch_size ? batch_size - old_size : batch_size;
+                text.resize(old_size + wanted);
+                const std::size_t count = source_.read(reinterpret_cast<typename source_type::value_type*>(&text[old_size]), wanted);
+                text.resize(old_size + count);
+                if (count == 0)
+                {
+                    return false;
+                }
+                // The carried over text has no line break, so only new text needs searching
+                const std::size_t pos = text.rfind('\n');
+                if (pos != std::string::npos && pos >= old_size)
+                {
+                    carry_.assign(text, pos + 1, std::string::npos);
+                    text.resize(pos + 1);
+                    return true;
+                }
+            }
+        }
+
+        class worker_pool
+        {
+            shared_state& state_;
+            std::vector<std::thread> threads_;
+        public:
+            worker_pool(shared_state& state)
+                : state_(state)
+            {
+            }
+
+            ~worker_pool() noexcept
+            {
+                stop();
+            }
+
+            // Starts the workers. If a thread cannot be created, stops the ones already
+            // started and returns the exception.
+            std::exception_ptr start(const basic_json_decode_options<char_type>& options,
+                const TempAlloc& temp_alloc, std::size_t num_threads)
+            {
+                JSONCONS_TRY
+                {
+                    threads_.reserve(num_threads);
+                    shared_state& state = state_;
+                    for (std::size_t i = 0; i < num_threads; ++i)
+                    {
+                        threads_.emplace_back([&state, options, temp_alloc]()
+                        {
+                            run_worker(state, options, temp_alloc);
+                        });
+                    }
+                }
+                JSONCONS_CATCH(...)
+                {
+                    stop();
+                    return std::current_exception();
+                }
+                return std::exception_ptr();
+            }
+
+            void stop() noexcept
+            {
+                {
+                    std::lock_guard<std::mutex> lock(state_.mutex);
+                    state_.done = true;
+                    state_.work.clear();
+                }
+                state_.work_ready.notify_all();
+                for (auto& t : threads_)
+                {
+                    t.join();
+                }
+                threads_.clear();
+            }
+        };
+
+        static void run_worker(shared_state& state, const basic_json_decode_options<char_type>& options, const TempAlloc& temp_alloc)
+        {
+            basic_json_parser<char_type,TempAlloc> parser(options, temp_alloc);
+            json_decoder<Json,TempAlloc> decoder(typename Json::allocator_type(), temp_alloc);
+
+            while (true)
+            {
+                batch b;
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.work_ready.wait(lock, [&state]{return state.done || !state.work.empty();});
+                    if (state.done)
+                    {
+                        return;
+                    }
+                    b = std::move(state.work.front());
+                    state.work.pop_front();
+                }
+
+                batch_result result;
+                result.seq = b.seq;
+                JSONCONS_TRY
+                {
+                    parse_batch(b, parser, decoder, result);
+                }
+                JSONCONS_CATCH(...)
+                {
+                    result.exception = std::current_exception();
+                }
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    state.results.push_back(std::move(result));
+                }
+                state.result_ready.notify_one();
+            }
+        }
+
+        static void parse_batch(const batch& b, basic_json_parser<char_type,TempAlloc>& parser,
+            json_decoder<Json,TempAlloc>& decoder, batch_result& result)
+        {
+            const char_type* p = reinterpret_cast<const char_type*>(b.text.data());
+            const char_type* last = p + b.text.size();
+            std::size_t line = b.first_line;
+
+            while (p < last)
+            {
+                const char_type* eol = std::find(p, last, '\n');
+                const char_type* q = p;
+                while (q < eol && (*q == ' ' || *q == '\t' || *q == '\r'))
+                {
+                    ++q;
+                }
+                if (q < eol)
+                {
+                    std::error_code ec;
+                    parser.reinitialize();
+                    decoder.reset();
+                    parser.update(p, static_cast<std::size_t>(eol - p));
+                    parser.parse_some(decoder, ec);
+                    if (!ec)
+                    {
+                        parser.finish_parse(decoder, ec);
+                    }
+                    if (!ec)
+                    {
+                        parser.check_done(ec);
+                    }
+                    if (ec)
+                    {
+                        result.ec = ec;
+                        result.line = line;
+                        result.column = parser.column();
+                        return;
+                    }
+                    result.records.emplace_back(line, decoder.get_result());
+                }
+                p = eol < last ? eol + 1 : last;
+                ++line;
+            }
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_LINES_READER_HPP
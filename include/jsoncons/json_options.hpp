@@ -7,6 +7,7 @@
 #ifndef JSONCONS_JSON_OPTIONS_HPP
 #define JSONCONS_JSON_OPTIONS_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <cwchar>
 #include <functional>
@@ -41,6 +42,10 @@ enum class byte_string_chars_format : uint8_t {none=0,base16,base64,base64url};
 
 enum class spaces_option : uint8_t {no_spaces=0,space_after,space_before,space_before_and_after};
 
+// Selects how contiguous, in-memory JSON text is parsed. automatic uses the indexed parser 
+// for narrow character inputs of at least indexed_parse_threshold bytes. 
+enum class parse_engine_kind : uint8_t {automatic=0, streaming, indexed};
+
 
 struct default_json_parsing
 {
@@ -258,10 +263,14 @@ public:
 private:
     bool lossless_number_{false};
     bool lossless_bignum_{true};
+    bool lazy_numbers_{false};
     bool allow_comments_{true};
     bool allow_trailing_comma_{false};
+    parse_engine_kind parse_engine_{parse_engine_kind::automatic};
     std::function<bool(json_errc,const ser_context&)> err_handler_;
 public:
+    static constexpr std::size_t indexed_parse_threshold = 4096;
+
     basic_json_decode_options()
         : err_handler_(default_json_parsing())
     {
@@ -273,8 +282,10 @@ public:
         : super_type(std::move(other)), 
           lossless_number_(other.lossless_number_), 
           lossless_bignum_(other.lossless_bignum_), 
+          lazy_numbers_(other.lazy_numbers_), 
           allow_comments_(other.allow_comments_), 
           allow_trailing_comma_(other.allow_trailing_comma_), 
+          parse_engine_(other.parse_engine_), 
           err_handler_(std::move(other.err_handler_))
     {
     }
@@ -290,6 +301,10 @@ public:
     {
         return lossless_bignum_;
     }
+    bool lazy_numbers() const 
+    {
+        return lazy_numbers_;
+    }
 
     bool allow_comments() const 
     {
@@ -301,6 +316,11 @@ public:
         return allow_trailing_comma_;
     }
 
+    parse_engine_kind parse_engine() const 
+    {
+        return parse_engine_;
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
     const std::function<bool(json_errc,const ser_context&)>& err_handler() const 
     {
@@ -499,8 +519,10 @@ public:
 
     using basic_json_decode_options<CharT>::lossless_number;
     using basic_json_decode_options<CharT>::lossless_bignum;
+    using basic_json_decode_options<CharT>::lazy_numbers;
     using basic_json_decode_options<CharT>::allow_comments;
     using basic_json_decode_options<CharT>::allow_trailing_comma;
+    using basic_json_decode_options<CharT>::parse_engine;
 #if !defined(JSONCONS_NO_DEPRECATED)
     using basic_json_decode_options<CharT>::err_handler;
 #endif
@@ -665,6 +687,12 @@ public:
         return *this;
     }
 
+    basic_json_options& lazy_numbers(bool value) 
+    {
+        this->lazy_numbers_ = value;
+        return *this;
+    }
+
     basic_json_options& allow_comments(bool value) 
     {
         this->allow_comments_ = value;
@@ -677,6 +705,12 @@ public:
         return *this;
     }
 
+    basic_json_options& parse_engine(parse_engine_kind value) 
+    {
+        this->parse_engine_ = value;
+        return *this;
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
     basic_json_options& err_handler(const std::function<bool(json_errc,const ser_context&)>& value) 
     {
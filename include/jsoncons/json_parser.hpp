@@ -7,6 +7,7 @@
 #ifndef JSONCONS_JSON_PARSER_HPP
 #define JSONCONS_JSON_PARSER_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional> // std::function
@@ -14,11 +15,13 @@
 #include <memory> // std::allocator
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/simd.hpp>
 #include <jsoncons/utility/read_number.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/json_exception.hpp>
@@ -132,6 +135,7 @@ private:
     bool allow_comments_;    
     bool lossless_number_;    
     bool lossless_bignum_; 
+    bool lazy_numbers_; 
     bool enable_str_to_inf_;   
     bool enable_str_to_neginf_;   
     bool enable_str_to_nan_;   
@@ -149,6 +153,7 @@ private:
     std::size_t begin_position_{0};
     const char_type* input_end_{nullptr};
     const char_type* input_ptr_{nullptr};
+    char_type* in_place_data_{nullptr};
     parse_state state_{parse_state::start};
     parse_string_state string_state_{};
     parse_number_state number_state_{};
@@ -158,6 +163,7 @@ private:
     int mark_level_{0};
     
     semantic_tag escape_tag_;
+    bool utf8_check_pending_{false};
     std::basic_string<char_type,std::char_traits<char_type>,char_allocator_type> buffer_;
 
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
@@ -185,6 +191,7 @@ public:
          allow_comments_(options.allow_comments()),
          lossless_number_(options.lossless_number()),
          lossless_bignum_(options.lossless_bignum()),
+         lazy_numbers_(options.lazy_numbers()),
          enable_str_to_inf_(options.enable_str_to_inf()),
          enable_str_to_neginf_(options.enable_str_to_neginf()),
          enable_str_to_nan_(options.enable_str_to_nan()),
@@ -220,6 +227,7 @@ public:
          allow_comments_(options.allow_comments()),
          lossless_number_(options.lossless_number()),
          lossless_bignum_(options.lossless_bignum()),
+         lazy_numbers_(options.lazy_numbers()),
          enable_str_to_inf_(options.enable_str_to_inf()),
          enable_str_to_neginf_(options.enable_str_to_neginf()),
          enable_str_to_nan_(options.enable_str_to_nan()),
@@ -487,6 +495,8 @@ public:
         begin_position_ = 0;
         input_end_ = nullptr;
         input_ptr_ = nullptr;
+        in_place_data_ = nullptr;
+        utf8_check_pending_ = false;
         buffer_.clear();
     }
 
@@ -551,6 +561,17 @@ public:
     {
         input_end_ = data + length;
         input_ptr_ = data;
+        in_place_data_ = nullptr;
+    }
+
+    // Like update, but strings are unescaped in place, overwriting data, and the string views
+    // passed to visit_string and visit_key point into data rather than into a copy. They remain
+    // valid for as long as data does. A string that does not end within data, or that needs
+    // error recovery, is copied as usual.
+    void update_in_place(char_type* data, std::size_t length)
+    {
+        update(data, length);
+        in_place_data_ = data;
     }
 
     void parse_some(basic_json_visitor<char_type>& visitor)
@@ -1809,11 +1830,11 @@ integer:
                 position_ += (cur - hdr);
                 return cur;
             }
-            if (JSONCONS_UNLIKELY(!jsoncons::is_digit(*cur)))
+            cur = skip_digits(cur, local_input_end);
+            if (JSONCONS_LIKELY(cur < local_input_end))
             {
                 break;
             }
-            ++cur;
         }
         if (*cur == '.')
         {
@@ -1858,11 +1879,11 @@ fraction2:
                 position_ += (cur - hdr);
                 return cur;
             }
-            if (JSONCONS_UNLIKELY(!jsoncons::is_digit(*cur)))
+            cur = skip_digits(cur, local_input_end);
+            if (JSONCONS_LIKELY(cur < local_input_end))
             {
                 break;
             }
-            ++cur;
         }
         if (jsoncons::is_exp(*cur))
         {
@@ -1930,11 +1951,11 @@ exp3:
                 position_ += (cur - hdr);
                 return cur;
             }
-            if (JSONCONS_UNLIKELY(!jsoncons::is_digit(*cur)))
+            cur = skip_digits(cur, local_input_end);
+            if (JSONCONS_LIKELY(cur < local_input_end))
             {
                 break;
             }
-            ++cur;
         }
         buffer_.append(hdr, cur);
         position_ += (cur - hdr);
@@ -1947,6 +1968,17 @@ exp3:
         const char_type* local_input_end = input_end_;
         const char_type* sb = cur;
 
+        if (in_place_data_ != nullptr && string_state_ == parse_string_state::text && buffer_.empty())
+        {
+            bool done = false;
+            cur = parse_string_in_place(cur, visitor, ec, done);
+            if (done)
+            {
+                return cur;
+            }
+            sb = cur;
+        }
+
         switch (string_state_)
         {
             case parse_string_state::text:
@@ -1980,6 +2012,11 @@ exp3:
 text:
         while (cur < local_input_end)
         {
+            cur = skip_string_text(cur, local_input_end);
+            if (JSONCONS_UNLIKELY(cur == local_input_end))
+            {
+                break;
+            }
             switch (*cur)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2040,7 +2077,8 @@ text:
                     return cur;
                 }
             default:
-                break;
+                cur = skip_non_ascii(cur, local_input_end);
+                continue;
             }
             ++cur;
         }
@@ -2319,6 +2357,156 @@ escape_u8:
         JSONCONS_UNREACHABLE();               
     }
 
+    // Writes code points to a char_type array
+    struct in_place_writer
+    {
+        using value_type = char_type;
+
+        char_type* ptr;
+
+        void push_back(char_type c)
+        {
+            *ptr++ = c;
+        }
+    };
+
+    static bool parse_hex4(const char_type* p, uint32_t& cp)
+    {
+        cp = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const char_type c = p[i];
+            cp *= 16;
+            if (c >= '0' && c <= '9')
+            {
+                cp += static_cast<uint32_t>(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                cp += static_cast<uint32_t>(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                cp += static_cast<uint32_t>(c - 'A' + 10);
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Parses a string that starts at cur in the buffer given to update_in_place, unescaping
+    // it over the input. Sets done when the string has ended. Otherwise stops at the first
+    // character that needs the general path, with the text decoded so far in buffer_.
+    const char_type* parse_string_in_place(const char_type* cur, basic_json_visitor<char_type>& visitor, 
+        std::error_code& ec, bool& done)
+    {
+        const char_type* local_input_end = input_end_;
+        const char_type* start = cur;
+        char_type* dest = in_place_data_ + (cur - in_place_data_);
+        const char_type* sb = cur;
+        bool escaped = false;
+
+        while (true)
+        {
+            cur = skip_string_text(cur, local_input_end);
+            if (JSONCONS_UNLIKELY(cur == local_input_end))
+            {
+                break;
+            }
+            switch (*cur)
+            {
+                case '\"':
+                {
+                    dest = escaped ? std::copy(sb, cur, dest) : dest + (cur - sb);
+                    position_ += (cur - start + 1);
+                    done = true;
+                    if (escaped)
+                    {
+                        escape_tag_ = semantic_tag::none;
+                    }
+                    end_string_value(start, static_cast<std::size_t>(dest - start), visitor, ec);
+                    if (JSONCONS_UNLIKELY(ec)) {return cur;}
+                    return cur + 1;
+                }
+                case '\\':
+                {
+                    dest = escaped ? std::copy(sb, cur, dest) : dest + (cur - sb);
+                    if (local_input_end - cur < 2)
+                    {
+                        goto handover;
+                    }
+                    char_type c = 0;
+                    switch (cur[1])
+                    {
+                        case '\"': c = '\"'; break;
+                        case '\\': c = '\\'; break;
+                        case '/': c = '/'; break;
+                        case 'b': c = '\b'; break;
+                        case 'f': c = '\f'; break;
+                        case 'n': c = '\n'; break;
+                        case 'r': c = '\r'; break;
+                        case 't': c = '\t'; break;
+                        case 'u':
+                        {
+                            uint32_t cp = 0;
+                            if (local_input_end - cur < 6 || !parse_hex4(cur + 2, cp))
+                            {
+                                goto handover;
+                            }
+                            std::size_t length = 6;
+                            if (unicode_traits::is_high_surrogate(cp))
+                            {
+                                uint32_t cp2 = 0;
+                                if (local_input_end - cur < 12 || cur[6] != '\\' || cur[7] != 'u' || !parse_hex4(cur + 8, cp2))
+                                {
+                                    goto handover;
+                                }
+                                cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                                length = 12;
+                            }
+                            in_place_writer writer{dest};
+                            unicode_traits::convert(&cp, 1, writer);
+                            dest = writer.ptr;
+                            cur += length;
+                            sb = cur;
+                            escaped = true;
+                            continue;
+                        }
+                        default:
+                            goto handover;
+                    }
+                    *dest++ = c;
+                    cur += 2;
+                    sb = cur;
+                    escaped = true;
+                    break;
+                }
+                JSONCONS_ILLEGAL_CONTROL_CHARACTER:
+                case '\n':
+                case '\r':
+                case '\t':
+                    dest = escaped ? std::copy(sb, cur, dest) : dest + (cur - sb);
+                    goto handover;
+                default:
+                    cur = skip_non_ascii(cur, local_input_end);
+                    break;
+            }
+        }
+        dest = escaped ? std::copy(sb, cur, dest) : dest + (cur - sb);
+
+handover:
+        if (escaped)
+        {
+            escape_tag_ = semantic_tag{};
+        }
+        buffer_.append(start, static_cast<std::size_t>(dest - start));
+        position_ += (cur - start);
+        return cur;
+    }
+
     void translate_conv_errc(unicode_traits::unicode_errc result, std::error_code& ec)
     {
         switch (result)
@@ -2395,6 +2583,101 @@ escape_u8:
 
 private:
 
+    // Advances past characters in string text that need no attention, stopping at 
+    // the first '"', '\\' or control character
+    static const char_type* skip_string_text(const char_type* cur, const char_type* end)
+    {
+        return skip_string_text(cur, end, std::integral_constant<bool,sizeof(char_type) == sizeof(char)>());
+    }
+
+    static const char_type* skip_string_text(const char_type* cur, const char_type* end, std::true_type)
+    {
+        const char* p = reinterpret_cast<const char*>(cur);
+        return cur + (detail::simd::find_string_special(p, reinterpret_cast<const char*>(end)) - p);
+    }
+
+    static const char_type* skip_string_text(const char_type* cur, const char_type*, std::false_type)
+    {
+        return cur;
+    }
+
+    static const char_type* skip_digits(const char_type* cur, const char_type* end)
+    {
+        return skip_digits(cur, end, std::integral_constant<bool,sizeof(char_type) == sizeof(char)>());
+    }
+
+    static const char_type* skip_digits(const char_type* cur, const char_type* end, std::true_type)
+    {
+        const char* p = reinterpret_cast<const char*>(cur);
+        return cur + (detail::simd::skip_digits(p, reinterpret_cast<const char*>(end)) - p);
+    }
+
+    static const char_type* skip_digits(const char_type* cur, const char_type* end, std::false_type)
+    {
+        while (cur < end && jsoncons::is_digit(*cur))
+        {
+            ++cur;
+        }
+        return cur;
+    }
+
+    // Validates the UTF-8 sequence starting at a non-ASCII byte as part of the text scan.
+    // Sequences that are malformed or cut off by the end of the chunk are left for 
+    // end_string_value to validate and report.
+    const char_type* skip_non_ascii(const char_type* cur, const char_type* end)
+    {
+        return skip_non_ascii(cur, end, std::integral_constant<bool,sizeof(char_type) == sizeof(char)>());
+    }
+
+    const char_type* skip_non_ascii(const char_type* cur, const char_type* end, std::true_type)
+    {
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(cur);
+        const std::size_t len = static_cast<std::size_t>(unicode_traits::trailing_bytes_for_utf8[*p]) + 1;
+        if (JSONCONS_UNLIKELY(len > static_cast<std::size_t>(end - cur) || 
+                              unicode_traits::is_legal_utf8(p, len) != unicode_traits::unicode_errc()))
+        {
+            utf8_check_pending_ = true;
+            return cur + 1;
+        }
+        return cur + len;
+    }
+
+    const char_type* skip_non_ascii(const char_type* cur, const char_type*, std::false_type)
+    {
+        return cur + 1;
+    }
+
+    // Narrow strings are validated during the text scan, wide strings when they end
+    bool string_needs_validation() const
+    {
+        return sizeof(char_type) != sizeof(char) || utf8_check_pending_;
+    }
+
+    // Indentation after a line break is skipped in blocks, counting the line feeds 
+    // it contains. Stops at '\r', which is left to skip_space.
+    const char_type* skip_indentation(const char_type* cur, const char_type* end)
+    {
+        return skip_indentation(cur, end, std::integral_constant<bool,sizeof(char_type) == sizeof(char)>());
+    }
+
+    const char_type* skip_indentation(const char_type* cur, const char_type* end, std::true_type)
+    {
+        const char* p = reinterpret_cast<const char*>(cur);
+        auto run = detail::simd::skip_space(p, reinterpret_cast<const char*>(end));
+        if (run.newlines > 0)
+        {
+            line_ += run.newlines;
+            mark_position_ = position_ + (run.line_start - p);
+        }
+        position_ += (run.ptr - p);
+        return cur + (run.ptr - p);
+    }
+
+    const char_type* skip_indentation(const char_type* cur, const char_type*, std::false_type)
+    {
+        return cur;
+    }
+
     void skip_space(char_type const ** ptr)
     {
         const char_type* local_input_end = input_end_;
@@ -2414,6 +2697,7 @@ private:
                 ++line_;
                 ++position_;
                 mark_position_ = position_;
+                cur = skip_indentation(cur, local_input_end);
                 continue;
             }
             if (*cur == '\r')
@@ -2429,6 +2713,7 @@ private:
                         ++position_;
                     }
                     mark_position_ = position_;
+                    cur = skip_indentation(cur, local_input_end);
                 }
                 else
                 {
@@ -2446,6 +2731,14 @@ private:
 
     void end_integer_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
     {
+        if (lazy_numbers_)
+        {
+            visitor.string_value(buffer_, semantic_tag::bigint, *this, ec);
+            if (JSONCONS_UNLIKELY(ec)){return;}
+            more_ = !cursor_mode_;
+            after_value(ec);
+            return;
+        }
         if (buffer_[0] == '-')
         {
             end_negative_value(visitor, ec);
@@ -2542,7 +2835,7 @@ private:
 
     void end_fraction_value(basic_json_visitor<char_type>& visitor, std::error_code& ec)
     {
-        if (lossless_number_)
+        if (lossless_number_ || lazy_numbers_)
         {
             visitor.string_value(buffer_, semantic_tag::bigdec, *this, ec);
             if (JSONCONS_UNLIKELY(ec)){return;}
@@ -2584,12 +2877,16 @@ private:
     void end_string_value(const char_type* s, std::size_t length, basic_json_visitor<char_type>& visitor, std::error_code& ec) 
     {
         string_view_type sv(s, length);
-        auto result = unicode_traits::validate(s, length);
-        if (result.ec != unicode_traits::unicode_errc())
+        if (JSONCONS_UNLIKELY(string_needs_validation()))
         {
-            translate_conv_errc(result.ec,ec);
-            position_ += (result.ptr - s);
-            return;
+            utf8_check_pending_ = false;
+            auto result = unicode_traits::validate(s, length);
+            if (result.ec != unicode_traits::unicode_errc())
+            {
+                translate_conv_errc(result.ec,ec);
+                position_ += (result.ptr - s);
+                return;
+            }
         }
         switch (parent())
         {
@@ -2748,6 +3045,224 @@ private:
 using json_parser = basic_json_parser<char>;
 using wjson_parser = basic_json_parser<wchar_t>;
 
+namespace detail {
+
+// Records the lengths of the arrays and objects in a document, in the order they begin
+template <typename CharT>
+class container_length_collector : public basic_default_json_visitor<CharT>
+{
+public:
+    using typename basic_json_visitor<CharT>::string_view_type;
+private:
+    std::vector<std::size_t>& lengths_;
+    std::vector<std::size_t> open_;
+public:
+    container_length_collector(std::vector<std::size_t>& lengths)
+        : lengths_(lengths)
+    {
+    }
+private:
+    void value()
+    {
+        if (!open_.empty())
+        {
+            ++lengths_[open_.back()];
+        }
+    }
+
+    void begin_container()
+    {
+        value();
+        open_.push_back(lengths_.size());
+        lengths_.push_back(0);
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag, const ser_context&, std::error_code&) override
+    {
+        begin_container();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context&, std::error_code&) override
+    {
+        open_.pop_back();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag, const ser_context&, std::error_code&) override
+    {
+        begin_container();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code&) override
+    {
+        open_.pop_back();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag, const ser_context&, std::error_code&) override
+    {
+        value();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type&, semantic_tag, const ser_context&, std::error_code&) override
+    {
+        value();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t, semantic_tag, const ser_context&, std::error_code&) override
+    {
+        value();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t, semantic_tag, const ser_context&, std::error_code&) override
+    {
+        value();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_double(double, semantic_tag, const ser_context&, std::error_code&) override
+    {
+        value();
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool, semantic_tag, const ser_context&, std::error_code&) override
+    {
+        value();
+        JSONCONS_VISITOR_RETURN;
+    }
+};
+
+// Passes the events of parsing a raw fragment on to destination, giving arrays and objects
+// the lengths found by container_length_collector. The parser's flush is not passed on,
+// the fragment being part of a larger document.
+template <typename CharT>
+class sized_container_forwarder : public basic_json_visitor<CharT>
+{
+public:
+    using typename basic_json_visitor<CharT>::string_view_type;
+private:
+    basic_json_visitor<CharT>& destination_;
+    const std::vector<std::size_t>& lengths_;
+    std::size_t index_{0};
+public:
+    sized_container_forwarder(basic_json_visitor<CharT>& destination, const std::vector<std::size_t>& lengths)
+        : destination_(destination), lengths_(lengths)
+    {
+    }
+private:
+    void visit_flush() override
+    {
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.begin_object(lengths_[index_++], tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context& context, std::error_code& ec) override
+    {
+        destination_.end_object(context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.begin_array(lengths_[index_++], tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context& context, std::error_code& ec) override
+    {
+        destination_.end_array(context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.key(name, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.null_value(tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.bool_value(value, tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.string_value(value, tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.byte_string_value(value, tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.uint64_value(value, tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.int64_value(value, tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+
+    JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        destination_.double_value(value, tag, context, ec);
+        JSONCONS_VISITOR_RETURN;
+    }
+};
+
+// Sends a raw fragment to a visitor that does not accept raw JSON text, as the events of 
+// parsing it. The text is parsed twice, first to find the lengths of its arrays and objects,
+// which encoders of binary formats need up front.
+template <typename CharT>
+void parse_raw_json(const typename basic_json_visitor<CharT>::string_view_type& text, 
+    basic_json_visitor<CharT>& visitor, std::error_code& ec)
+{
+    std::vector<std::size_t> lengths;
+    container_length_collector<CharT> collector(lengths);
+    basic_json_parser<CharT,std::allocator<char>> parser;
+    parser.update(text.data(), text.size());
+    parser.finish_parse(collector, ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return;
+    }
+    parser.check_done(ec);
+    if (JSONCONS_UNLIKELY(ec))
+    {
+        return;
+    }
+
+    sized_container_forwarder<CharT> forwarder(visitor, lengths);
+    parser.reset();
+    parser.update(text.data(), text.size());
+    parser.finish_parse(forwarder, ec);
+}
+
+} // namespace detail
+
 } // namespace jsoncons
 
 #endif // JSONCONS_JSON_PARSER_HPP
@@ -0,0 +1,148 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_RECLAIMER_HPP
+#define JSONCONS_JSON_RECLAIMER_HPP
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_arena.hpp>
+#include <jsoncons/json_type.hpp>
+
+namespace jsoncons {
+
+    // basic_json_reclaimer
+
+    // Destroys basic_json values on a background thread, so that the thread that lets go of a
+    // large document does not wait for it to be torn down. The allocator of the values must be
+    // usable from the reclaimer's thread.
+    template <typename Json>
+    class basic_json_reclaimer
+    {
+    public:
+        using value_type = Json;
+    private:
+        std::mutex mutex_;
+        std::condition_variable work_ready_;
+        std::condition_variable idle_;
+        std::vector<Json> pending_;
+        bool busy_{false};
+        bool done_{false};
+        std::thread thread_;
+
+        // Noncopyable and nonmoveable
+        basic_json_reclaimer(const basic_json_reclaimer&) = delete;
+        basic_json_reclaimer& operator=(const basic_json_reclaimer&) = delete;
+    public:
+        basic_json_reclaimer()
+            : thread_([this]() { run(); })
+        {
+        }
+
+        // Destroys the values still pending before returning
+        ~basic_json_reclaimer() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_ = true;
+            }
+            work_ready_.notify_one();
+            thread_.join();
+        }
+
+        // The reclaimer used by deferred_destroy
+        static basic_json_reclaimer& instance()
+        {
+            static basic_json_reclaimer reclaimer;
+            return reclaimer;
+        }
+
+        // Takes ownership of value and destroys it on the reclaimer's thread. Values that are
+        // cheap to destroy, such as numbers, strings and empty arrays and objects, are destroyed
+        // on the calling thread.
+        void reclaim(Json&& value)
+        {
+            if (!is_costly_to_destroy(value))
+            {
+                Json temp(std::move(value));
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pending_.push_back(std::move(value));
+            }
+            work_ready_.notify_one();
+        }
+
+        // Blocks until the values handed over so far have been destroyed
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_.wait(lock, [this]() { return pending_.empty() && !busy_; });
+        }
+
+    private:
+        static bool is_costly_to_destroy(const Json& value)
+        {
+            if (is_monotonic_allocator<typename Json::allocator_type>::value)
+            {
+                return false;
+            }
+            switch (value.storage_kind())
+            {
+                case json_storage_kind::array:
+                case json_storage_kind::object:
+                    return !value.empty();
+                default:
+                    return false;
+            }
+        }
+
+        void run()
+        {
+            std::vector<Json> batch;
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true)
+            {
+                work_ready_.wait(lock, [this]() { return done_ || !pending_.empty(); });
+                if (pending_.empty())
+                {
+                    break;
+                }
+                // Keep the capacity of both vectors so that reclaim does not allocate once warmed up
+                batch.swap(pending_);
+                busy_ = true;
+                lock.unlock();
+                batch.clear();
+                lock.lock();
+                busy_ = false;
+                if (pending_.empty())
+                {
+                    idle_.notify_all();
+                }
+            }
+        }
+    };
+
+    // Hands value to basic_json_reclaimer<Json>::instance() to be destroyed on its thread.
+    // Should not be called during static destruction.
+    template <typename CharT,typename Policy,typename Allocator>
+    void deferred_destroy(basic_json<CharT,Policy,Allocator>&& value)
+    {
+        basic_json_reclaimer<basic_json<CharT,Policy,Allocator>>::instance().reclaim(std::move(value));
+    }
+
+    using json_reclaimer = basic_json_reclaimer<json>;
+    using ojson_reclaimer = basic_json_reclaimer<ojson>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_RECLAIMER_HPP
@@ -0,0 +1,1163 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_TAPE_HPP
+#define JSONCONS_JSON_TAPE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/decode_json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_reader.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/utility/read_number.hpp>
+
+namespace jsoncons {
+
+template <typename CharT,typename Allocator>
+class basic_json_tape;
+
+namespace detail {
+
+    enum class tape_kind : uint8_t
+    {
+        null_value,
+        true_value,
+        false_value,
+        int64_value,
+        uint64_value,
+        double_value,
+        string_value,
+        byte_string_value,
+        array_value,
+        object_value
+    };
+
+    template <typename CharT,typename Words>
+    class json_tape_builder;
+
+} // namespace detail
+
+// A value in a basic_json_tape. A value is the first 64 bit word of its encoding in the tape,
+// and is only ever accessed by reference into the tape.
+//
+// Each value starts with a word holding its kind in the top 8 bits, its semantic tag in the
+// next 8 bits, and a 48 bit payload:
+//
+//   null, true, false   1 word
+//   int64, uint64       2 words, the payload word is followed by the value
+//   double              2 words, the payload word is followed by the bits of the value
+//   string              1 word with the length, followed by the characters padded to a whole word
+//   byte string         1 word with the length, 1 word with the extension tag, then the bytes
+//   array, object       1 word with the number of elements or members, 1 word with the number
+//                       of words in the whole array or object, then the elements, or the
+//                       members as key string followed by value
+//
+// so any value can be skipped in constant time.
+//
+// Numbers kept as text, for example by the lossless_number option, are strings tagged bigint or
+// bigdec, and are numbers to is_number, is_int64, is_uint64 and is_double as they are in basic_json.
+// Unlike basic_json, an object keeps every member in input order, including members with the
+// same key, and find returns the first of them.
+template <typename CharT>
+class basic_json_tape_value
+{
+    template <typename C,typename A> friend class basic_json_tape;
+    template <typename C,typename W> friend class jsoncons::detail::json_tape_builder;
+public:
+    using char_type = CharT;
+    using string_view_type = jsoncons::basic_string_view<char_type>;
+    using string_type = std::basic_string<char_type>;
+
+    class member
+    {
+        friend class basic_json_tape_value;
+
+        const basic_json_tape_value* key_;
+
+        explicit member(const basic_json_tape_value* key) noexcept
+            : key_(key)
+        {
+        }
+    public:
+        string_view_type key() const noexcept
+        {
+            return key_->string_view_unchecked();
+        }
+
+        const basic_json_tape_value& value() const noexcept
+        {
+            return *key_->next();
+        }
+    };
+
+    class object_iterator
+    {
+        friend class basic_json_tape_value;
+
+        const basic_json_tape_value* key_{nullptr};
+
+        explicit object_iterator(const basic_json_tape_value* key) noexcept
+            : key_(key)
+        {
+        }
+
+        struct arrow_proxy
+        {
+            member m;
+
+            const member* operator->() const noexcept
+            {
+                return std::addressof(m);
+            }
+        };
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = member;
+        using difference_type = std::ptrdiff_t;
+        using pointer = arrow_proxy;
+        using reference = member;
+
+        object_iterator() = default;
+
+        reference operator*() const noexcept
+        {
+            return member(key_);
+        }
+
+        pointer operator->() const noexcept
+        {
+            return arrow_proxy{member(key_)};
+        }
+
+        object_iterator& operator++() noexcept
+        {
+            key_ = key_->next()->next();
+            return *this;
+        }
+
+        object_iterator operator++(int) noexcept
+        {
+            object_iterator temp(*this);
+            ++(*this);
+            return temp;
+        }
+
+        friend bool operator==(const object_iterator& lhs, const object_iterator& rhs) noexcept
+        {
+            return lhs.key_ == rhs.key_;
+        }
+
+        friend bool operator!=(const object_iterator& lhs, const object_iterator& rhs) noexcept
+        {
+            return lhs.key_ != rhs.key_;
+        }
+    };
+
+    using const_object_iterator = object_iterator;
+
+    class array_iterator
+    {
+        friend class basic_json_tape_value;
+
+        const basic_json_tape_value* p_{nullptr};
+
+        explicit array_iterator(const basic_json_tape_value* p) noexcept
+            : p_(p)
+        {
+        }
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = basic_json_tape_value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const basic_json_tape_value*;
+        using reference = const basic_json_tape_value&;
+
+        array_iterator() = default;
+
+        reference operator*() const noexcept
+        {
+            return *p_;
+        }
+
+        pointer operator->() const noexcept
+        {
+            return p_;
+        }
+
+        array_iterator& operator++() noexcept
+        {
+            p_ = p_->next();
+            return *this;
+        }
+
+        array_iterator operator++(int) noexcept
+        {
+            array_iterator temp(*this);
+            ++(*this);
+            return temp;
+        }
+
+        friend bool operator==(const array_iterator& lhs, const array_iterator& rhs) noexcept
+        {
+            return lhs.p_ == rhs.p_;
+        }
+
+        friend bool operator!=(const array_iterator& lhs, const array_iterator& rhs) noexcept
+        {
+            return lhs.p_ != rhs.p_;
+        }
+    };
+
+    using const_array_iterator = array_iterator;
+private:
+    using tape_kind = jsoncons::detail::tape_kind;
+
+    struct raw_word_arg_t
+    {
+        explicit raw_word_arg_t() = default;
+    };
+
+    static constexpr int kind_shift = 56;
+    static constexpr int tag_shift = 48;
+    static constexpr uint64_t payload_mask = (uint64_t(1) << tag_shift) - 1;
+
+    uint64_t word_;
+public:
+    basic_json_tape_value(raw_word_arg_t, uint64_t word) noexcept
+        : word_(word)
+    {
+    }
+
+    // Values live in a tape, the copy constructor is explicit so that `auto v = tape.root();`
+    // does not compile
+    explicit basic_json_tape_value(const basic_json_tape_value&) = default;
+
+    basic_json_tape_value& operator=(const basic_json_tape_value&) = delete;
+
+    json_type type() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::null_value:
+                return json_type::null_value;
+            case tape_kind::true_value:
+            case tape_kind::false_value:
+                return json_type::bool_value;
+            case tape_kind::int64_value:
+                return json_type::int64_value;
+            case tape_kind::uint64_value:
+                return json_type::uint64_value;
+            case tape_kind::double_value:
+                return json_type::double_value;
+            case tape_kind::string_value:
+                return json_type::string_value;
+            case tape_kind::byte_string_value:
+                return json_type::byte_string_value;
+            case tape_kind::array_value:
+                return json_type::array_value;
+            default:
+                return json_type::object_value;
+        }
+    }
+
+    semantic_tag tag() const noexcept
+    {
+        return static_cast<semantic_tag>((word_ >> tag_shift) & 0xff);
+    }
+
+    bool is_null() const noexcept
+    {
+        return kind() == tape_kind::null_value;
+    }
+
+    bool is_bool() const noexcept
+    {
+        return kind() == tape_kind::true_value || kind() == tape_kind::false_value;
+    }
+
+    bool is_string() const noexcept
+    {
+        return kind() == tape_kind::string_value;
+    }
+
+    bool is_byte_string() const noexcept
+    {
+        return kind() == tape_kind::byte_string_value;
+    }
+
+    bool is_int64() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::int64_value:
+                return true;
+            case tape_kind::uint64_value:
+                return (this + 1)->word_ <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)());
+            case tape_kind::string_value:
+                return is_integer_text<int64_t>();
+            default:
+                return false;
+        }
+    }
+
+    bool is_uint64() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::uint64_value:
+                return true;
+            case tape_kind::int64_value:
+                return static_cast<int64_t>((this + 1)->word_) >= 0;
+            case tape_kind::string_value:
+                return is_integer_text<uint64_t>();
+            default:
+                return false;
+        }
+    }
+
+    bool is_double() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::double_value:
+                return true;
+            case tape_kind::string_value:
+                return tag() == semantic_tag::bigdec;
+            default:
+                return false;
+        }
+    }
+
+    bool is_number() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::int64_value:
+            case tape_kind::uint64_value:
+            case tape_kind::double_value:
+                return true;
+            case tape_kind::string_value:
+                return is_number_tag(tag());
+            default:
+                return false;
+        }
+    }
+
+    bool is_array() const noexcept
+    {
+        return kind() == tape_kind::array_value;
+    }
+
+    bool is_object() const noexcept
+    {
+        return kind() == tape_kind::object_value;
+    }
+
+    // The number of elements in an array or members in an object, otherwise 0
+    std::size_t size() const noexcept
+    {
+        return is_array() || is_object() ? static_cast<std::size_t>(payload()) : 0;
+    }
+
+    bool empty() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::string_value:
+            case tape_kind::byte_string_value:
+            case tape_kind::array_value:
+            case tape_kind::object_value:
+                return payload() == 0;
+            default:
+                return false;
+        }
+    }
+
+    object_iterator find(const string_view_type& key) const
+    {
+        if (!is_object())
+        {
+            JSONCONS_THROW(not_an_object(key.data(),key.length()));
+        }
+        const basic_json_tape_value* last = next();
+        const basic_json_tape_value* p = first_child();
+        while (p != last && p->string_view_unchecked() != key)
+        {
+            p = p->next()->next();
+        }
+        return object_iterator(p);
+    }
+
+    bool contains(const string_view_type& key) const
+    {
+        return is_object() && find(key) != object_iterator(next());
+    }
+
+    const basic_json_tape_value& at(const string_view_type& key) const
+    {
+        auto it = find(key);
+        if (it == object_iterator(next()))
+        {
+            JSONCONS_THROW(key_not_found(key.data(),key.length()));
+        }
+        return it->value();
+    }
+
+    const basic_json_tape_value& operator[](const string_view_type& key) const
+    {
+        return at(key);
+    }
+
+    // Skips the elements before i, each in constant time
+    const basic_json_tape_value& at(std::size_t i) const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+        }
+        if (i >= size())
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        const basic_json_tape_value* p = first_child();
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            p = p->next();
+        }
+        return *p;
+    }
+
+    const basic_json_tape_value& operator[](std::size_t i) const
+    {
+        return at(i);
+    }
+
+    range<object_iterator,object_iterator> object_range() const
+    {
+        if (!is_object())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+        }
+        return range<object_iterator,object_iterator>(object_iterator(first_child()), object_iterator(next()));
+    }
+
+    range<array_iterator,array_iterator> array_range() const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+        }
+        return range<array_iterator,array_iterator>(array_iterator(first_child()), array_iterator(next()));
+    }
+
+    bool as_bool() const
+    {
+        switch (kind())
+        {
+            case tape_kind::true_value:
+                return true;
+            case tape_kind::false_value:
+                return false;
+            case tape_kind::int64_value:
+            case tape_kind::uint64_value:
+                return (this + 1)->word_ != 0;
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+        }
+    }
+
+    template <typename IntegerType>
+    IntegerType as_integer() const
+    {
+        switch (kind())
+        {
+            case tape_kind::int64_value:
+                return static_cast<IntegerType>(static_cast<int64_t>((this + 1)->word_));
+            case tape_kind::uint64_value:
+                return static_cast<IntegerType>((this + 1)->word_);
+            case tape_kind::double_value:
+                return static_cast<IntegerType>(double_unchecked());
+            case tape_kind::true_value:
+                return static_cast<IntegerType>(1);
+            case tape_kind::false_value:
+                return static_cast<IntegerType>(0);
+            case tape_kind::string_value:
+            {
+                IntegerType val;
+                auto sv = string_view_unchecked();
+                auto result = to_integer(sv.data(), sv.length(), val);
+                if (!result)
+                {
+                    JSONCONS_THROW(json_runtime_error<std::runtime_error>(result.error_code().message()));
+                }
+                return val;
+            }
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an integer"));
+        }
+    }
+
+    double as_double() const
+    {
+        switch (kind())
+        {
+            case tape_kind::int64_value:
+                return static_cast<double>(static_cast<int64_t>((this + 1)->word_));
+            case tape_kind::uint64_value:
+                return static_cast<double>((this + 1)->word_);
+            case tape_kind::double_value:
+                return double_unchecked();
+            case tape_kind::string_value:
+            {
+                // As basic_json::as<double>, text out of range converts to infinity or zero
+                double val{0};
+                string_type s(string_view_unchecked());
+                const bool is_hex = (s.length() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) ||
+                    (s.length() > 3 && s[0] == '-' && s[1] == '0' && (s[2] == 'x' || s[2] == 'X'));
+                auto result = is_hex ? hexstr_to_double(s.c_str(), s.length(), val)
+                    : decstr_to_double(s.c_str(), s.length(), val);
+                if (result.ec == std::errc::invalid_argument)
+                {
+                    JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Not a double"));
+                }
+                return val;
+            }
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a double"));
+        }
+    }
+
+    // A string's value, otherwise the JSON text of the value
+    string_type as_string() const
+    {
+        if (is_string())
+        {
+            return string_type(string_view_unchecked());
+        }
+        string_type s;
+        dump(s);
+        return s;
+    }
+
+    string_view_type as_string_view() const
+    {
+        if (!is_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+        }
+        return string_view_unchecked();
+    }
+
+    byte_string_view as_byte_string_view() const
+    {
+        if (!is_byte_string())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a byte string"));
+        }
+        return byte_string_view(reinterpret_cast<const uint8_t*>(this + 2), static_cast<std::size_t>(payload()));
+    }
+
+    // Converts this value. Strings, booleans and numbers are converted directly, a basic_json is
+    // built from the tape, and anything else is decoded from the JSON text of this value.
+    template <typename T>
+    T as() const
+    {
+        return as_(type_tag<T>());
+    }
+
+    void dump(basic_json_visitor<char_type>& visitor) const
+    {
+        std::error_code ec;
+        dump(visitor, ec);
+        if (JSONCONS_UNLIKELY(ec))
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+    }
+
+    void dump(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+    {
+        dump_noflush(visitor, ec);
+        if (JSONCONS_LIKELY(!ec))
+        {
+            visitor.flush();
+        }
+    }
+
+    template <typename CharContainer>
+    typename std::enable_if<ext_traits::is_back_insertable_char_container<CharContainer>::value>::type
+    dump(CharContainer& cont,
+         const basic_json_encode_options<char_type>& options = basic_json_options<char_type>()) const
+    {
+        basic_compact_json_encoder<char_type,jsoncons::string_sink<CharContainer>> encoder(cont, options);
+        dump(encoder);
+    }
+
+    string_type to_string() const
+    {
+        string_type s;
+        dump(s);
+        return s;
+    }
+
+private:
+    template <typename T>
+    struct type_tag {};
+
+    template <typename T>
+    using is_integer_type = std::integral_constant<bool,std::is_integral<T>::value && !std::is_same<T,bool>::value>;
+
+    static uint64_t make_word(tape_kind kind, semantic_tag tag, uint64_t payload) noexcept
+    {
+        return (static_cast<uint64_t>(kind) << kind_shift) | (static_cast<uint64_t>(tag) << tag_shift) | payload;
+    }
+
+    static std::size_t words_for(std::size_t bytes) noexcept
+    {
+        return (bytes + sizeof(uint64_t) - 1)/sizeof(uint64_t);
+    }
+
+    tape_kind kind() const noexcept
+    {
+        return static_cast<tape_kind>(word_ >> kind_shift);
+    }
+
+    uint64_t payload() const noexcept
+    {
+        return word_ & payload_mask;
+    }
+
+    // The number of words taken by this value, including any children
+    std::size_t word_count() const noexcept
+    {
+        switch (kind())
+        {
+            case tape_kind::null_value:
+            case tape_kind::true_value:
+            case tape_kind::false_value:
+                return 1;
+            case tape_kind::int64_value:
+            case tape_kind::uint64_value:
+            case tape_kind::double_value:
+                return 2;
+            case tape_kind::string_value:
+                return 1 + words_for(static_cast<std::size_t>(payload())*sizeof(char_type));
+            case tape_kind::byte_string_value:
+                return 2 + words_for(static_cast<std::size_t>(payload()));
+            default:
+                return static_cast<std::size_t>((this + 1)->word_);
+        }
+    }
+
+    const basic_json_tape_value* next() const noexcept
+    {
+        return this + word_count();
+    }
+
+    const basic_json_tape_value* first_child() const noexcept
+    {
+        return this + 2;
+    }
+
+    string_view_type string_view_unchecked() const noexcept
+    {
+        return string_view_type(reinterpret_cast<const char_type*>(this + 1), static_cast<std::size_t>(payload()));
+    }
+
+    // True if this is integer text, such as a number kept as text by the parser's
+    // lossless_bignum or lazy_numbers options, that fits in T
+    template <typename T>
+    bool is_integer_text() const noexcept
+    {
+        if (tag() != semantic_tag::bigint)
+        {
+            return false;
+        }
+        T val;
+        auto sv = string_view_unchecked();
+        auto result = jsoncons::to_integer<T>(sv.data(), sv.length(), val);
+        return result ? true : false;
+    }
+
+    double double_unchecked() const noexcept
+    {
+        double val;
+        std::memcpy(&val, &(this + 1)->word_, sizeof(double));
+        return val;
+    }
+
+    void dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+    {
+        const ser_context context{};
+        switch (kind())
+        {
+            case tape_kind::null_value:
+                visitor.null_value(tag(), context, ec);
+                break;
+            case tape_kind::true_value:
+                visitor.bool_value(true, tag(), context, ec);
+                break;
+            case tape_kind::false_value:
+                visitor.bool_value(false, tag(), context, ec);
+                break;
+            case tape_kind::int64_value:
+                visitor.int64_value(static_cast<int64_t>((this + 1)->word_), tag(), context, ec);
+                break;
+            case tape_kind::uint64_value:
+                visitor.uint64_value((this + 1)->word_, tag(), context, ec);
+                break;
+            case tape_kind::double_value:
+                visitor.double_value(double_unchecked(), tag(), context, ec);
+                break;
+            case tape_kind::string_value:
+                visitor.string_value(string_view_unchecked(), tag(), context, ec);
+                break;
+            case tape_kind::byte_string_value:
+                if (tag() == semantic_tag::ext)
+                {
+                    visitor.byte_string_value(as_byte_string_view(), (this + 1)->word_, context, ec);
+                }
+                else
+                {
+                    visitor.byte_string_value(as_byte_string_view(), tag(), context, ec);
+                }
+                break;
+            case tape_kind::array_value:
+            {
+                visitor.begin_array(size(), tag(), context, ec);
+                const basic_json_tape_value* last = next();
+                for (const basic_json_tape_value* p = first_child(); p != last && !ec; p = p->next())
+                {
+                    p->dump_noflush(visitor, ec);
+                }
+                if (JSONCONS_LIKELY(!ec))
+                {
+                    visitor.end_array(context, ec);
+                }
+                break;
+            }
+            case tape_kind::object_value:
+            {
+                visitor.begin_object(size(), tag(), context, ec);
+                const basic_json_tape_value* last = next();
+                for (const basic_json_tape_value* p = first_child(); p != last && !ec; p = p->next()->next())
+                {
+                    visitor.key(p->string_view_unchecked(), context, ec);
+                    if (JSONCONS_LIKELY(!ec))
+                    {
+                        p->next()->dump_noflush(visitor, ec);
+                    }
+                }
+                if (JSONCONS_LIKELY(!ec))
+                {
+                    visitor.end_object(context, ec);
+                }
+                break;
+            }
+        }
+    }
+
+    bool as_(type_tag<bool>) const
+    {
+        return as_bool();
+    }
+
+    double as_(type_tag<double>) const
+    {
+        return as_double();
+    }
+
+    float as_(type_tag<float>) const
+    {
+        return static_cast<float>(as_double());
+    }
+
+    string_type as_(type_tag<string_type>) const
+    {
+        return as_string();
+    }
+
+    string_view_type as_(type_tag<string_view_type>) const
+    {
+        return as_string_view();
+    }
+
+    byte_string_view as_(type_tag<byte_string_view>) const
+    {
+        return as_byte_string_view();
+    }
+
+    template <typename T>
+    typename std::enable_if<is_integer_type<T>::value,T>::type
+    as_(type_tag<T>) const
+    {
+        return as_integer<T>();
+    }
+
+    template <typename T>
+    typename std::enable_if<ext_traits::is_basic_json<T>::value,T>::type
+    as_(type_tag<T>) const
+    {
+        json_decoder<T> decoder;
+        dump(decoder);
+        return decoder.get_result();
+    }
+
+    template <typename T>
+    typename std::enable_if<!is_integer_type<T>::value && !ext_traits::is_basic_json<T>::value,T>::type
+    as_(type_tag<T>) const
+    {
+        return decode_json<T>(to_string());
+    }
+};
+
+namespace detail {
+
+    // Appends the encoding of the parsed value to the words of a tape
+    template <typename CharT,typename Words>
+    class json_tape_builder final : public basic_json_visitor<CharT>
+    {
+    public:
+        using typename basic_json_visitor<CharT>::string_view_type;
+    private:
+        using value_type = typename Words::value_type;
+        using raw_word_arg_t = typename value_type::raw_word_arg_t;
+
+        struct container
+        {
+            std::size_t pos;
+            std::size_t count;
+        };
+
+        Words& words_;
+        std::vector<container> stack_;
+        bool is_valid_{false};
+    public:
+        explicit json_tape_builder(Words& words)
+            : words_(words)
+        {
+        }
+
+        bool is_valid() const noexcept
+        {
+            return is_valid_;
+        }
+
+    private:
+        void push_word(uint64_t word)
+        {
+            words_.emplace_back(raw_word_arg_t(), word);
+        }
+
+        // Appends bytes padded with zeros to a whole number of words
+        void push_data(const void* data, std::size_t bytes)
+        {
+            const std::size_t pos = words_.size();
+            const std::size_t n = value_type::words_for(bytes);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                push_word(0);
+            }
+            if (bytes > 0)
+            {
+                std::memcpy(static_cast<void*>(words_.data() + pos), data, bytes);
+            }
+        }
+
+        void push_string(const string_view_type& sv, semantic_tag tag)
+        {
+            push_word(value_type::make_word(tape_kind::string_value, tag, sv.size()));
+            push_data(sv.data(), sv.size()*sizeof(CharT));
+        }
+
+        void value_added() noexcept
+        {
+            if (stack_.empty())
+            {
+                is_valid_ = true;
+            }
+            else
+            {
+                ++stack_.back().count;
+            }
+        }
+
+        void begin_container(tape_kind kind, semantic_tag tag)
+        {
+            stack_.push_back(container{words_.size(), 0});
+            push_word(value_type::make_word(kind, tag, 0));
+            push_word(0);
+        }
+
+        void end_container()
+        {
+            const container c = stack_.back();
+            stack_.pop_back();
+            uint64_t& header = words_[c.pos].word_;
+            header = (header & ~value_type::payload_mask) | static_cast<uint64_t>(c.count);
+            words_[c.pos + 1].word_ = static_cast<uint64_t>(words_.size() - c.pos);
+            value_added();
+        }
+
+        void visit_flush() final
+        {
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_object(semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            begin_container(tape_kind::object_value, tag);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_object(const ser_context&, std::error_code&) final
+        {
+            end_container();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            begin_container(tape_kind::array_value, tag);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_end_array(const ser_context&, std::error_code&) final
+        {
+            end_container();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& name, const ser_context&, std::error_code&) final
+        {
+            push_string(name, semantic_tag::none);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& sv, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push_string(sv, tag);
+            value_added();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b,
+            semantic_tag tag,
+            const ser_context&,
+            std::error_code&) final
+        {
+            push_word(value_type::make_word(tape_kind::byte_string_value, tag, b.size()));
+            push_byte_string_data(b, 0);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& b,
+            uint64_t raw_tag,
+            const ser_context&,
+            std::error_code&) final
+        {
+            push_word(value_type::make_word(tape_kind::byte_string_value, semantic_tag::ext, b.size()));
+            push_byte_string_data(b, raw_tag);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        void push_byte_string_data(const byte_string_view& b, uint64_t raw_tag)
+        {
+            push_word(raw_tag);
+            push_data(b.data(), b.size());
+            value_added();
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_int64(int64_t value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push_word(value_type::make_word(tape_kind::int64_value, tag, 0));
+            push_word(static_cast<uint64_t>(value));
+            value_added();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_uint64(uint64_t value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push_word(value_type::make_word(tape_kind::uint64_value, tag, 0));
+            push_word(value);
+            value_added();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) final
+        {
+            return visit_double(binary::decode_half(value), tag, context, ec);
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_double(double value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(double));
+            push_word(value_type::make_word(tape_kind::double_value, tag, 0));
+            push_word(bits);
+            value_added();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push_word(value_type::make_word(value ? tape_kind::true_value : tape_kind::false_value, tag, 0));
+            value_added();
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_null(semantic_tag tag, const ser_context&, std::error_code&) final
+        {
+            push_word(value_type::make_word(tape_kind::null_value, tag, 0));
+            value_added();
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+} // namespace detail
+
+// An immutable JSON document held in one contiguous tape of 64 bit words, see basic_json_tape_value
+// for the encoding. Compared to a basic_json tree, a tape uses less memory, is traversed in
+// memory order, and is destroyed by freeing a single buffer.
+template <typename CharT,typename Allocator = std::allocator<char>>
+class basic_json_tape
+{
+public:
+    using char_type = CharT;
+    using allocator_type = Allocator;
+    using value_type = basic_json_tape_value<CharT>;
+    using string_view_type = jsoncons::basic_string_view<char_type>;
+private:
+    using word_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<value_type>;
+    using words_type = std::vector<value_type,word_allocator_type>;
+
+    words_type words_;
+public:
+    // A tape holding null
+    explicit basic_json_tape(const Allocator& alloc = Allocator())
+        : words_(word_allocator_type(alloc))
+    {
+        words_.emplace_back(typename value_type::raw_word_arg_t(), value_type::make_word(jsoncons::detail::tape_kind::null_value, semantic_tag::none, 0));
+    }
+
+    // Encodes the value j
+    template <typename Json>
+    explicit basic_json_tape(const Json& j, const Allocator& alloc = Allocator(),
+        typename std::enable_if<ext_traits::is_basic_json<Json>::value && std::is_same<typename Json::char_type,char_type>::value,int>::type = 0)
+        : words_(word_allocator_type(alloc))
+    {
+        jsoncons::detail::json_tape_builder<char_type,words_type> builder(words_);
+        j.dump(builder);
+        words_.shrink_to_fit();
+    }
+
+    basic_json_tape(const basic_json_tape&) = default;
+
+    basic_json_tape(basic_json_tape&&) = default;
+
+    basic_json_tape& operator=(const basic_json_tape& other)
+    {
+        if (this != &other)
+        {
+            basic_json_tape temp(other);
+            words_.swap(temp.words_);
+        }
+        return *this;
+    }
+
+    basic_json_tape& operator=(basic_json_tape&& other) noexcept
+    {
+        words_.swap(other.words_);
+        return *this;
+    }
+
+    static basic_json_tape parse(const string_view_type& source,
+        const basic_json_decode_options<char_type>& options = basic_json_options<char_type>(),
+        const Allocator& alloc = Allocator())
+    {
+        auto r = unicode_traits::detect_encoding_from_bom(source.data(), source.size());
+        std::size_t offset = (r.ptr - source.data());
+
+        basic_json_tape tape(alloc);
+        tape.words_.clear();
+        jsoncons::detail::json_tape_builder<char_type,words_type> builder(tape.words_);
+        basic_json_parser<char_type> parser(options);
+
+        if (!(r.encoding == unicode_traits::encoding_kind::utf8 || r.encoding == unicode_traits::encoding_kind::undetected))
+        {
+            JSONCONS_THROW(ser_error(json_errc::illegal_unicode_character,parser.line(),parser.column()));
+        }
+        parser.update(source.data()+offset,source.size()-offset);
+        parser.parse_some(builder);
+        parser.finish_parse(builder);
+        parser.check_done();
+        if (JSONCONS_UNLIKELY(!builder.is_valid()))
+        {
+            JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to parse json string"));
+        }
+        tape.words_.shrink_to_fit();
+        return tape;
+    }
+
+    static basic_json_tape parse(std::basic_istream<char_type>& is,
+        const basic_json_decode_options<char_type>& options = basic_json_options<char_type>(),
+        const Allocator& alloc = Allocator())
+    {
+        basic_json_tape tape(alloc);
+        tape.words_.clear();
+        jsoncons::detail::json_tape_builder<char_type,words_type> builder(tape.words_);
+        basic_json_reader<char_type,stream_source<char_type>> reader(is, builder, options);
+        reader.read_next();
+        reader.check_done();
+        if (JSONCONS_UNLIKELY(!builder.is_valid()))
+        {
+            JSONCONS_THROW(ser_error(json_errc::source_error, "Failed to parse json stream"));
+        }
+        tape.words_.shrink_to_fit();
+        return tape;
+    }
+
+    const value_type& root() const noexcept
+    {
+        return words_.front();
+    }
+
+    // The number of 64 bit words in the tape
+    std::size_t tape_size() const noexcept
+    {
+        return words_.size();
+    }
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type(words_.get_allocator());
+    }
+};
+
+using json_tape = basic_json_tape<char>;
+using wjson_tape = basic_json_tape<wchar_t>;
+using json_tape_value = basic_json_tape_value<char>;
+using wjson_tape_value = basic_json_tape_value<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_TAPE_HPP
@@ -163,6 +163,13 @@ namespace jsoncons {
 
     JSONCONS_INLINE_CONSTEXPR const_json_ptr_arg_t const_json_ptr_arg{};
 
+    struct in_place_arg_t
+    {
+        explicit in_place_arg_t() = default; 
+    };
+
+    JSONCONS_INLINE_CONSTEXPR in_place_arg_t in_place_arg{};
+
     struct json_ptr_arg_t
     {
         explicit json_ptr_arg_t() = default; 
@@ -204,6 +211,7 @@ namespace jsoncons {
         short_str = 7,            // 0111
         const_json_ref = 8,       // 1000    
         json_ref = 9,             // 1001    
+        raw_json = 10,            // 1010
         byte_str = 12,            // 1100  
         object = 13,              // 1101
         array = 14,               // 1110
@@ -222,7 +230,8 @@ namespace jsoncons {
     {
         static constexpr uint8_t mask{ uint8_t(json_storage_kind::long_str) & uint8_t(json_storage_kind::byte_str) 
             & uint8_t(json_storage_kind::array) & uint8_t(json_storage_kind::object) };
-        return (uint8_t(storage_kind) & mask) != mask;
+        // raw_json owns heap memory but does not share the bits of the other kinds that do
+        return (uint8_t(storage_kind) & mask) != mask && storage_kind != json_storage_kind::raw_json;
     }
 
     inline bool is_string_storage(json_storage_kind storage_kind) noexcept
@@ -248,6 +257,7 @@ namespace jsoncons {
         static constexpr const CharT* object_value = JSONCONS_CSTRING_CONSTANT(CharT, "object");
         static constexpr const CharT* const_json_ref = JSONCONS_CSTRING_CONSTANT(CharT, "const_json_ref");
         static constexpr const CharT* json_ref = JSONCONS_CSTRING_CONSTANT(CharT, "json_ref");
+        static constexpr const CharT* raw_json = JSONCONS_CSTRING_CONSTANT(CharT, "raw_json");
 
         switch (storage)
         {
@@ -321,6 +331,11 @@ namespace jsoncons {
                 os << json_ref;
                 break;
             }
+            case json_storage_kind::raw_json:
+            {
+                os << raw_json;
+                break;
+            }
         }
         return os;
     }
@@ -0,0 +1,923 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_VIEW_HPP
+#define JSONCONS_JSON_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/decode_json.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/utility/read_number.hpp>
+
+namespace jsoncons {
+
+template <typename CharT>
+class basic_json_view;
+
+// A member of an object, or an element of an array, in a basic_json_view
+template <typename CharT>
+class basic_json_view_member
+{
+    friend class basic_json_view<CharT>;
+public:
+    using char_type = CharT;
+    using string_view_type = jsoncons::basic_string_view<char_type>;
+    using string_type = std::basic_string<char_type>;
+private:
+    string_view_type key_;
+    string_type decoded_key_;
+    basic_json_view<CharT> value_;
+
+    basic_json_view_member(string_view_type key, basic_json_view<CharT>&& value)
+        : key_(key), value_(std::move(value))
+    {
+    }
+public:
+    basic_json_view_member(const basic_json_view_member& other)
+        : key_(other.key_), decoded_key_(other.decoded_key_), value_(other.value_)
+    {
+        if (!decoded_key_.empty())
+        {
+            key_ = decoded_key_;
+        }
+    }
+
+    basic_json_view_member(basic_json_view_member&& other) noexcept
+        : key_(other.key_), decoded_key_(std::move(other.decoded_key_)), value_(std::move(other.value_))
+    {
+        if (!decoded_key_.empty())
+        {
+            key_ = decoded_key_;
+        }
+    }
+
+    basic_json_view_member& operator=(const basic_json_view_member&) = delete;
+    basic_json_view_member& operator=(basic_json_view_member&&) = delete;
+
+    string_view_type key() const
+    {
+        return key_;
+    }
+
+    const basic_json_view<CharT>& value() const
+    {
+        return value_;
+    }
+};
+
+// basic_json_view is a read only JSON document over text that the caller keeps alive.
+// Nothing is parsed up front. A container finds its direct children the first time one of
+// them is accessed, skipping over nested values without building them, and scalars are
+// converted only when asked for. Memory and time therefore depend on the parts of the
+// document that are accessed rather than on its size.
+//
+// Only the parts of the text that are accessed are checked for errors, which are reported
+// by throwing ser_error. Views of the children of a container are created once and keep
+// their addresses, so functions like jsonpointer::get, that return references into a
+// const document, work with basic_json_view as they do with basic_json. A view is not
+// safe for concurrent access from several threads, as accessing it may build its index.
+
+template <typename CharT>
+class basic_json_view
+{
+public:
+    using char_type = CharT;
+    using char_traits_type = std::char_traits<char_type>;
+    using string_view_type = jsoncons::basic_string_view<char_type>;
+    using string_type = std::basic_string<char_type>;
+    using member_type = basic_json_view_member<CharT>;
+    using key_value_type = member_type;
+    using object_iterator = typename std::vector<member_type>::const_iterator;
+    using const_object_iterator = object_iterator;
+
+    class array_iterator
+    {
+        object_iterator it_;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = basic_json_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const basic_json_view*;
+        using reference = const basic_json_view&;
+
+        array_iterator() = default;
+
+        explicit array_iterator(object_iterator it)
+            : it_(it)
+        {
+        }
+
+        reference operator*() const
+        {
+            return it_->value();
+        }
+
+        pointer operator->() const
+        {
+            return std::addressof(it_->value());
+        }
+
+        array_iterator& operator++()
+        {
+            ++it_;
+            return *this;
+        }
+
+        array_iterator operator++(int)
+        {
+            array_iterator temp(*this);
+            ++it_;
+            return temp;
+        }
+
+        array_iterator& operator--()
+        {
+            --it_;
+            return *this;
+        }
+
+        array_iterator operator--(int)
+        {
+            array_iterator temp(*this);
+            --it_;
+            return temp;
+        }
+
+        array_iterator& operator+=(difference_type n)
+        {
+            it_ += n;
+            return *this;
+        }
+
+        array_iterator operator+(difference_type n) const
+        {
+            return array_iterator(it_ + n);
+        }
+
+        difference_type operator-(const array_iterator& other) const
+        {
+            return it_ - other.it_;
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return it_[n].value();
+        }
+
+        friend bool operator==(const array_iterator& lhs, const array_iterator& rhs)
+        {
+            return lhs.it_ == rhs.it_;
+        }
+
+        friend bool operator!=(const array_iterator& lhs, const array_iterator& rhs)
+        {
+            return lhs.it_ != rhs.it_;
+        }
+
+        friend bool operator<(const array_iterator& lhs, const array_iterator& rhs)
+        {
+            return lhs.it_ < rhs.it_;
+        }
+    };
+
+    using const_array_iterator = array_iterator;
+private:
+    static constexpr std::size_t max_number_buffer_length = 64;
+
+    const char_type* text_;
+    const char_type* text_end_;
+    const char_type* first_;
+    mutable const char_type* last_{nullptr};
+    mutable std::unique_ptr<std::vector<member_type>> members_;
+    mutable std::unique_ptr<string_type> decoded_;
+
+    basic_json_view(const char_type* text, const char_type* text_end, const char_type* first)
+        : text_(text), text_end_(text_end), first_(first)
+    {
+    }
+public:
+    basic_json_view(const char_type* data, std::size_t length)
+        : text_(data), text_end_(data + length), first_(skip_space(data, data + length))
+    {
+        if (first_ == text_end_)
+        {
+            throw_error(json_errc::unexpected_eof, first_);
+        }
+    }
+
+    explicit basic_json_view(const string_view_type& text)
+        : basic_json_view(text.data(), text.size())
+    {
+    }
+
+    basic_json_view(const basic_json_view& other)
+        : text_(other.text_), text_end_(other.text_end_), first_(other.first_), last_(other.last_)
+    {
+    }
+
+    basic_json_view(basic_json_view&&) = default;
+
+    basic_json_view& operator=(const basic_json_view& other)
+    {
+        if (this != &other)
+        {
+            text_ = other.text_;
+            text_end_ = other.text_end_;
+            first_ = other.first_;
+            last_ = other.last_;
+            members_.reset();
+            decoded_.reset();
+        }
+        return *this;
+    }
+
+    basic_json_view& operator=(basic_json_view&&) = default;
+
+    // The JSON text of this value
+    string_view_type raw_text() const
+    {
+        return string_view_type(first_, static_cast<std::size_t>(value_end() - first_));
+    }
+
+    json_type type() const
+    {
+        switch (*first_)
+        {
+            case '{':
+                return json_type::object_value;
+            case '[':
+                return json_type::array_value;
+            case '\"':
+                return json_type::string_value;
+            case 't':
+            case 'f':
+                check_literal();
+                return json_type::bool_value;
+            case 'n':
+                check_literal();
+                return json_type::null_value;
+            default:
+                return number_type();
+        }
+    }
+
+    bool is_null() const
+    {
+        return type() == json_type::null_value;
+    }
+
+    bool is_bool() const
+    {
+        return type() == json_type::bool_value;
+    }
+
+    bool is_string() const
+    {
+        return *first_ == '\"';
+    }
+
+    bool is_array() const
+    {
+        return *first_ == '[';
+    }
+
+    bool is_object() const
+    {
+        return *first_ == '{';
+    }
+
+    bool is_number() const
+    {
+        switch (type())
+        {
+            case json_type::int64_value:
+            case json_type::uint64_value:
+            case json_type::double_value:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool is_int64() const
+    {
+        int64_t val;
+        return is_number() && to_integer(first_, static_cast<std::size_t>(value_end() - first_), val);
+    }
+
+    bool is_uint64() const
+    {
+        uint64_t val;
+        return is_number() && to_integer(first_, static_cast<std::size_t>(value_end() - first_), val);
+    }
+
+    bool is_double() const
+    {
+        return type() == json_type::double_value;
+    }
+
+    // The number of elements in an array or members in an object, otherwise 0
+    std::size_t size() const
+    {
+        return is_array() || is_object() ? members().size() : 0;
+    }
+
+    bool empty() const
+    {
+        switch (*first_)
+        {
+            case '[':
+            case '{':
+                return members().empty();
+            case '\"':
+                return value_end() - first_ == 2;
+            default:
+                return false;
+        }
+    }
+
+    object_iterator find(const string_view_type& key) const
+    {
+        if (!is_object())
+        {
+            JSONCONS_THROW(not_an_object(key.data(),key.length()));
+        }
+        const auto& m = members();
+        return std::find_if(m.begin(), m.end(), [&key](const member_type& member){return member.key() == key;});
+    }
+
+    bool contains(const string_view_type& key) const
+    {
+        return is_object() && find(key) != members().end();
+    }
+
+    const basic_json_view& at(const string_view_type& key) const
+    {
+        auto it = find(key);
+        if (it == members().end())
+        {
+            JSONCONS_THROW(key_not_found(key.data(),key.length()));
+        }
+        return it->value();
+    }
+
+    const basic_json_view& operator[](const string_view_type& key) const
+    {
+        return at(key);
+    }
+
+    const basic_json_view& at(std::size_t i) const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+        }
+        const auto& m = members();
+        if (i >= m.size())
+        {
+            JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+        }
+        return m[i].value();
+    }
+
+    const basic_json_view& operator[](std::size_t i) const
+    {
+        return at(i);
+    }
+
+    range<object_iterator,object_iterator> object_range() const
+    {
+        if (!is_object())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+        }
+        const auto& m = members();
+        return range<object_iterator,object_iterator>(m.begin(), m.end());
+    }
+
+    range<array_iterator,array_iterator> array_range() const
+    {
+        if (!is_array())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+        }
+        const auto& m = members();
+        return range<array_iterator,array_iterator>(array_iterator(m.begin()), array_iterator(m.end()));
+    }
+
+    bool as_bool() const
+    {
+        if (type() != json_type::bool_value)
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+        }
+        return *first_ == 't';
+    }
+
+    template <typename IntegerType>
+    IntegerType as_integer() const
+    {
+        if (!is_number())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an integer"));
+        }
+        IntegerType val;
+        auto result = to_integer(first_, static_cast<std::size_t>(value_end() - first_), val);
+        if (!result)
+        {
+            // Like basic_json, a number that is not an integer is truncated
+            return static_cast<IntegerType>(as_double());
+        }
+        return val;
+    }
+
+    double as_double() const
+    {
+        if (!is_number())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a double"));
+        }
+        // decstr_to_double may fall back to strtod, which needs a terminating null. Numbers of
+        // ordinary length are copied to a stack buffer for it, longer ones to a string.
+        const char_type* last = value_end();
+        const std::size_t length = static_cast<std::size_t>(last - first_);
+        double val{0};
+        to_number_result<char_type> result(first_);
+        if (length < max_number_buffer_length)
+        {
+            char_type buf[max_number_buffer_length];
+            std::copy(first_, last, buf);
+            buf[length] = 0;
+            result = decstr_to_double(buf, length, val);
+        }
+        else
+        {
+            string_type s(first_, last);
+            result = decstr_to_double(s.c_str(), length, val);
+        }
+        if (!result)
+        {
+            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Not a double"));
+        }
+        return val;
+    }
+
+    // A string's value, otherwise the JSON text of the value
+    string_type as_string() const
+    {
+        return string_type(as_string_view());
+    }
+
+    // A string's value, decoded the first time it is asked for if it contains escapes
+    string_view_type as_string_view() const
+    {
+        if (!is_string())
+        {
+            return raw_text();
+        }
+        const char_type* last = value_end();
+        string_view_type quoted(first_ + 1, static_cast<std::size_t>(last - first_ - 2));
+        if (quoted.find('\\') == string_view_type::npos)
+        {
+            return quoted;
+        }
+        if (!decoded_)
+        {
+            decoded_.reset(new string_type(decode_string(first_, last)));
+        }
+        return *decoded_;
+    }
+
+    // Converts this value. Strings, booleans and numbers are converted directly from the
+    // text, anything else, including basic_json, is decoded from the text of this value.
+    template <typename T>
+    T as() const
+    {
+        return as_(type_tag<T>());
+    }
+
+private:
+    template <typename T>
+    struct type_tag {};
+
+    template <typename T>
+    using is_integer_type = std::integral_constant<bool,std::is_integral<T>::value && !std::is_same<T,bool>::value>;
+
+    bool as_(type_tag<bool>) const
+    {
+        return as_bool();
+    }
+
+    double as_(type_tag<double>) const
+    {
+        return as_double();
+    }
+
+    float as_(type_tag<float>) const
+    {
+        return static_cast<float>(as_double());
+    }
+
+    string_type as_(type_tag<string_type>) const
+    {
+        return as_string();
+    }
+
+    string_view_type as_(type_tag<string_view_type>) const
+    {
+        return as_string_view();
+    }
+
+    template <typename T>
+    typename std::enable_if<is_integer_type<T>::value,T>::type
+    as_(type_tag<T>) const
+    {
+        return as_integer<T>();
+    }
+
+    template <typename T>
+    typename std::enable_if<!is_integer_type<T>::value,T>::type
+    as_(type_tag<T>) const
+    {
+        return decode_json<T>(raw_text());
+    }
+
+    static const char_type* skip_space(const char_type* p, const char_type* last)
+    {
+        while (p < last && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+        {
+            ++p;
+        }
+        return p;
+    }
+
+    // p is the opening quote, returns one past the closing quote
+    const char_type* skip_string(const char_type* p) const
+    {
+        const char_type* cur = p + 1;
+        while (true)
+        {
+            const char_type* q = char_traits_type::find(cur, static_cast<std::size_t>(text_end_ - cur), '\"');
+            if (q == nullptr)
+            {
+                throw_error(json_errc::unexpected_eof, text_end_);
+            }
+            // The quote is escaped if an odd number of backslashes precede it
+            const char_type* b = q;
+            while (b > cur && *(b-1) == '\\')
+            {
+                --b;
+            }
+            if (((q - b) & 1) == 0)
+            {
+                return q + 1;
+            }
+            cur = q + 1;
+        }
+    }
+
+    // p is the first character of a value, returns one past its last character
+    const char_type* skip_value(const char_type* p) const
+    {
+        switch (*p)
+        {
+            case '\"':
+                return skip_string(p);
+            case '[':
+            case '{':
+            {
+                // The closers expected for the open arrays and objects, innermost last
+                std::vector<char_type> closers;
+                const char_type* cur = p;
+                while (cur < text_end_)
+                {
+                    switch (*cur)
+                    {
+                        case '\"':
+                            cur = skip_string(cur);
+                            continue;
+                        case '[':
+                            closers.push_back(']');
+                            break;
+                        case '{':
+                            closers.push_back('}');
+                            break;
+                        case ']':
+                        case '}':
+                            if (closers.back() != *cur)
+                            {
+                                throw_error(*cur == ']' ? json_errc::unexpected_rbracket : json_errc::unexpected_rbrace, cur);
+                            }
+                            closers.pop_back();
+                            if (closers.empty())
+                            {
+                                return cur + 1;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    ++cur;
+                }
+                throw_error(json_errc::unexpected_eof, text_end_);
+            }
+            default:
+            {
+                const char_type* cur = p;
+                while (cur < text_end_)
+                {
+                    switch (*cur)
+                    {
+                        case ',': case ']': case '}': case ' ': case '\t': case '\n': case '\r':
+                            return cur;
+                        default:
+                            ++cur;
+                            break;
+                    }
+                }
+                return cur;
+            }
+        }
+    }
+
+    const char_type* value_end() const
+    {
+        if (last_ == nullptr)
+        {
+            last_ = skip_value(first_);
+        }
+        return last_;
+    }
+
+    void check_value_start(const char_type* p) const
+    {
+        if (p == text_end_)
+        {
+            throw_error(json_errc::unexpected_eof, p);
+        }
+        switch (*p)
+        {
+            case '{': case '[': case '\"': case '-': case 't': case 'f': case 'n':
+            case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+                break;
+            default:
+                throw_error(json_errc::syntax_error, p);
+        }
+    }
+
+    const std::vector<member_type>& members() const
+    {
+        if (!members_)
+        {
+            members_.reset(new std::vector<member_type>());
+            JSONCONS_TRY
+            {
+                index_members(*members_);
+            }
+            JSONCONS_CATCH(...)
+            {
+                members_.reset();
+                JSONCONS_RETHROW;
+            }
+        }
+        return *members_;
+    }
+
+    // Finds the direct children of this array or object
+    void index_members(std::vector<member_type>& members) const
+    {
+        const bool is_obj = *first_ == '{';
+        const char_type end_char = is_obj ? '}' : ']';
+
+        const char_type* p = skip_space(first_ + 1, text_end_);
+        if (p < text_end_ && *p == end_char)
+        {
+            last_ = p + 1;
+            return;
+        }
+        while (true)
+        {
+            string_view_type key;
+            string_type decoded_key;
+            if (is_obj)
+            {
+                if (p == text_end_)
+                {
+                    throw_error(json_errc::unexpected_eof, p);
+                }
+                if (*p != '\"')
+                {
+                    throw_error(json_errc::expected_key, p);
+                }
+                const char_type* key_end = skip_string(p);
+                key = string_view_type(p + 1, static_cast<std::size_t>(key_end - p - 2));
+                if (key.find('\\') != string_view_type::npos)
+                {
+                    decoded_key = decode_string(p, key_end);
+                }
+                p = skip_space(key_end, text_end_);
+                if (p == text_end_)
+                {
+                    throw_error(json_errc::unexpected_eof, p);
+                }
+                if (*p != ':')
+                {
+                    throw_error(json_errc::expected_colon, p);
+                }
+                p = skip_space(p + 1, text_end_);
+            }
+            check_value_start(p);
+            basic_json_view value(text_, text_end_, p);
+            p = value.value_end();
+            members.push_back(member_type(key, std::move(value)));
+            if (!decoded_key.empty())
+            {
+                members.back().decoded_key_ = std::move(decoded_key);
+                members.back().key_ = members.back().decoded_key_;
+            }
+
+            p = skip_space(p, text_end_);
+            if (p == text_end_)
+            {
+                throw_error(json_errc::unexpected_eof, p);
+            }
+            if (*p == end_char)
+            {
+                last_ = p + 1;
+                return;
+            }
+            if (*p != ',')
+            {
+                throw_error(is_obj ? json_errc::expected_comma_or_rbrace : json_errc::expected_comma_or_rbracket, p);
+            }
+            p = skip_space(p + 1, text_end_);
+        }
+    }
+
+    string_type decode_string(const char_type* first, const char_type* last) const
+    {
+        std::error_code ec;
+        basic_json_parser<char_type> parser;
+        string_decoder decoder;
+        parser.update(first, static_cast<std::size_t>(last - first));
+        parser.parse_some(decoder, ec);
+        if (!ec)
+        {
+            parser.finish_parse(decoder, ec);
+        }
+        if (ec)
+        {
+            throw_error(ec, first + (parser.position() > 0 ? parser.position() - 1 : 0));
+        }
+        return std::move(decoder.value);
+    }
+
+    struct string_decoder : public basic_default_json_visitor<char_type>
+    {
+        string_type value;
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& s, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            value.assign(s.data(), s.size());
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+    void check_literal() const
+    {
+        static const char_type true_literal[] = {'t','r','u','e'};
+        static const char_type false_literal[] = {'f','a','l','s','e'};
+        static const char_type null_literal[] = {'n','u','l','l'};
+
+        const char_type* literal = *first_ == 't' ? true_literal : (*first_ == 'f' ? false_literal : null_literal);
+        const std::size_t length = *first_ == 'f' ? 5 : 4;
+        const char_type* last = value_end();
+        if (static_cast<std::size_t>(last - first_) != length || !std::equal(first_, last, literal))
+        {
+            throw_error(json_errc::invalid_value, first_);
+        }
+    }
+
+    json_type number_type() const
+    {
+        // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        const char_type* last = value_end();
+        const char_type* p = first_;
+        bool integer = true;
+        if (p < last && *p == '-')
+        {
+            ++p;
+        }
+        if (p < last && *p == '0')
+        {
+            ++p;
+        }
+        else if (p < last && *p >= '1' && *p <= '9')
+        {
+            while (p < last && *p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+        }
+        else
+        {
+            throw_error(json_errc::invalid_number, p);
+        }
+        if (p < last && *p == '.')
+        {
+            integer = false;
+            const char_type* digits = ++p;
+            while (p < last && *p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+            if (p == digits)
+            {
+                throw_error(json_errc::invalid_number, p);
+            }
+        }
+        if (p < last && (*p == 'e' || *p == 'E'))
+        {
+            integer = false;
+            ++p;
+            if (p < last && (*p == '+' || *p == '-'))
+            {
+                ++p;
+            }
+            const char_type* digits = p;
+            while (p < last && *p >= '0' && *p <= '9')
+            {
+                ++p;
+            }
+            if (p == digits)
+            {
+                throw_error(json_errc::invalid_number, p);
+            }
+        }
+        if (p != last)
+        {
+            throw_error(json_errc::invalid_number, p);
+        }
+        if (integer)
+        {
+            if (*first_ == '-')
+            {
+                int64_t val;
+                if (to_integer(first_, static_cast<std::size_t>(last - first_), val))
+                {
+                    return json_type::int64_value;
+                }
+            }
+            else
+            {
+                uint64_t val;
+                if (to_integer(first_, static_cast<std::size_t>(last - first_), val))
+                {
+                    return json_type::uint64_value;
+                }
+            }
+        }
+        return json_type::double_value;
+    }
+
+    [[noreturn]] void throw_error(std::error_code ec, const char_type* pos) const
+    {
+        std::size_t line = 1;
+        const char_type* line_start = text_;
+        for (const char_type* p = text_; p < pos; ++p)
+        {
+            if (*p == '\n')
+            {
+                ++line;
+                line_start = p + 1;
+            }
+        }
+        JSONCONS_THROW(ser_error(ec, line, static_cast<std::size_t>(pos - line_start) + 1));
+    }
+};
+
+using json_view = basic_json_view<char>;
+using wjson_view = basic_json_view<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_VIEW_HPP
@@ -15,6 +15,7 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_error.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_options.hpp>
 #include <jsoncons/json_type.hpp>
@@ -230,6 +231,26 @@ namespace jsoncons {
             JSONCONS_VISITOR_RETURN;
         }
 
+        // Whether raw_json_value is accepted. basic_json sends a raw fragment to other visitors 
+        // as the events of parsing it.
+        virtual bool accepts_raw_json() const noexcept
+        {
+            return false;
+        }
+
+        // text is the serialized form of a single JSON value
+        JSONCONS_VISITOR_RETURN_TYPE raw_json_value(const string_view_type& text, 
+            const ser_context& context=ser_context()) 
+        {
+            std::error_code ec;
+            visit_raw_json(text, context, ec);
+            if (JSONCONS_UNLIKELY(ec))
+            {
+                JSONCONS_THROW(ser_error(ec, context.line(), context.column()));
+            }
+            JSONCONS_VISITOR_RETURN;
+        }
+
         template <typename BytesViewLike>
         JSONCONS_VISITOR_RETURN_TYPE byte_string_value(const BytesViewLike& b, 
             semantic_tag tag=semantic_tag::none, 
@@ -385,6 +406,14 @@ namespace jsoncons {
             JSONCONS_VISITOR_RETURN;
         }
 
+        JSONCONS_VISITOR_RETURN_TYPE raw_json_value(const string_view_type& text, 
+            const ser_context& context,
+            std::error_code& ec) 
+        {
+            visit_raw_json(text, context, ec);
+            JSONCONS_VISITOR_RETURN;
+        }
+
         template <typename Source>
         JSONCONS_VISITOR_RETURN_TYPE byte_string_value(const Source& b, 
             semantic_tag tag, 
@@ -583,6 +612,16 @@ namespace jsoncons {
             const ser_context& context, 
             std::error_code& ec) = 0;
 
+        // Visitors that write JSON text override this to copy text to their output, and
+        // accepts_raw_json to return true
+        virtual JSONCONS_VISITOR_RETURN_TYPE visit_raw_json(const string_view_type&, 
+            const ser_context&, 
+            std::error_code& ec)
+        {
+            ec = json_errc::unexpected_raw_json;
+            JSONCONS_VISITOR_RETURN;
+        }
+
         virtual JSONCONS_VISITOR_RETURN_TYPE visit_byte_string(const byte_string_view& value, 
             semantic_tag tag, 
             const ser_context& context,
@@ -27,10 +27,13 @@
 #include <jsoncons/json_array.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/key_value.hpp>
+#include <jsoncons/detail/key_index.hpp>
 
 namespace jsoncons {
 
-    // Preserve order
+    // Preserve order. Objects with more than index_threshold members also keep a hash index
+    // of member positions, built on first growth past the threshold, so that lookups do not
+    // scan every key.
     template <typename KeyT,typename Json,template <typename,typename> class SequenceContainer = std::vector>
     class ordered_json_object : public allocator_holder<typename Json::allocator_type>
     {
@@ -44,8 +47,12 @@ namespace jsoncons {
 
         using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
         using key_value_container_type = SequenceContainer<key_value_type,key_value_allocator_type>;
+        using index_type = jsoncons::detail::key_index<allocator_type>;
+
+        static constexpr std::size_t index_threshold = 16;
 
         key_value_container_type data_;
+        index_type index_; // empty, or holds the position of every member
 
         struct Comp
         {
@@ -71,31 +78,36 @@ namespace jsoncons {
 
         ordered_json_object(const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              data_(key_value_allocator_type(alloc))
+              data_(key_value_allocator_type(alloc)),
+              index_(alloc)
         {
         }
 
         ordered_json_object(const ordered_json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              data_(val.data_)
+              data_(val.data_),
+              index_(val.index_)
         {
         }
 
         ordered_json_object(ordered_json_object&& val,const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              data_(std::move(val.data_),key_value_allocator_type(alloc))
+              data_(std::move(val.data_),key_value_allocator_type(alloc)),
+              index_(std::move(val.index_),alloc)
         {
         }
 
         ordered_json_object(ordered_json_object&& val) noexcept
             : allocator_holder<allocator_type>(val.get_allocator()), 
-              data_(std::move(val.data_))
+              data_(std::move(val.data_)),
+              index_(std::move(val.index_))
         {
         }
 
         ordered_json_object(const ordered_json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              data_(val.data_,key_value_allocator_type(alloc))
+              data_(val.data_,key_value_allocator_type(alloc)),
+              index_(val.index_,alloc)
         {
         }
 
@@ -117,6 +129,7 @@ namespace jsoncons {
                         if (JSONCONS_LIKELY(!bloom_may_contain(bloom, h)))
                         {
                             data_.emplace_back(key_type(key.begin(), key.end(),get_allocator()), get_value(*it));
+                            index_last();
                             bloom_set(bloom, h);
                         }
                         else
@@ -140,7 +153,8 @@ namespace jsoncons {
         template <typename InputIt>
         ordered_json_object(InputIt first, InputIt last, const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              data_(key_value_allocator_type(alloc))
+              data_(key_value_allocator_type(alloc)),
+              index_(alloc)
         {
             std::size_t count = std::distance(first,last);
             if (count > 0)
@@ -157,6 +171,7 @@ namespace jsoncons {
                         if (JSONCONS_LIKELY(!bloom_may_contain(bloom, h)))
                         {
                             data_.emplace_back(key_type(key.begin(), key.end(),get_allocator()), get_value(*it));
+                            index_last();
                             bloom_set(bloom, h);
                         }
                         else
@@ -180,7 +195,8 @@ namespace jsoncons {
         ordered_json_object(std::initializer_list<std::pair<std::basic_string<char_type>,Json>> init, 
                     const allocator_type& alloc = allocator_type())
             : allocator_holder<allocator_type>(alloc), 
-              data_(key_value_allocator_type(alloc))
+              data_(key_value_allocator_type(alloc)),
+              index_(alloc)
         {
             data_.reserve(init.size());
             for (auto& item : init)
@@ -202,13 +218,16 @@ namespace jsoncons {
 
         ordered_json_object& operator=(const ordered_json_object& val)
         {
+            index_.clear();
             data_ = val.data_;
+            index_ = val.index_;
             return *this;
         }
 
         void swap(ordered_json_object& other) noexcept
         {
             data_.swap(other.data_);
+            index_.swap(other.index_);
         }
 
         bool empty() const
@@ -247,6 +266,7 @@ namespace jsoncons {
         void clear() 
         {
             data_.clear();
+            index_.reset();
         }
 
         void shrink_to_fit() 
@@ -256,6 +276,14 @@ namespace jsoncons {
                 data_[i].shrink_to_fit();
             }
             data_.shrink_to_fit();
+            if (data_.size() <= index_threshold)
+            {
+                index_.reset();
+            }
+            else if (index_type::capacity_for(data_.size()) < index_.capacity())
+            {
+                rebuild_index();
+            }
         }
 
         void reserve(std::size_t n) {data_.reserve(n);}
@@ -280,34 +308,20 @@ namespace jsoncons {
 
         iterator find(string_view_type key) noexcept
         {
-            const size_type length = size();
-            for (size_type i = 0; i < length; ++i) 
-            {
-               if (data_[i].key() == key) 
-               {
-                   return data_.begin() + i;
-               }
-            }
-            return data_.end();
+            return data_.begin() + find_pos(key);
         }
 
         const_iterator find(string_view_type key) const noexcept
         {
-            const size_type length = size();
-            for (size_type i = 0; i < length; ++i) 
-            {
-               if (data_[i].key() == key) 
-               {
-                   return data_.begin() + i;
-               }
-            }
-            return data_.end();
+            return data_.begin() + find_pos(key);
         }
 
         iterator erase(const_iterator pos) 
         {
             if (pos != data_.end())
             {
+                const std::size_t i = static_cast<std::size_t>(pos - data_.begin());
+                unindex(i, i + 1);
                 return data_.erase(pos);
             }
             else
@@ -323,7 +337,7 @@ namespace jsoncons {
 
             if (pos1 < data_.size() && pos2 <= data_.size())
             {
-
+                unindex(pos1, pos2);
                 return data_.erase(first,last);
             }
             else
@@ -334,10 +348,11 @@ namespace jsoncons {
 
         size_type erase(string_view_type key) 
         {
-            auto pos = find(key);
-            if (pos != data_.end())
+            const std::size_t pos = find_pos(key);
+            if (pos != data_.size())
             {
-                data_.erase(pos);
+                unindex(pos, pos + 1);
+                data_.erase(data_.begin() + pos);
                 return 1;
             }
             return 0;
@@ -379,6 +394,7 @@ namespace jsoncons {
                         if (JSONCONS_LIKELY(!bloom_may_contain(bloom, h)))
                         {
                             data_.emplace_back(std::move(p->name), std::move(p->value));
+                            index_last();
                             bloom_set(bloom, h);
                         }
                         else
@@ -423,6 +439,7 @@ namespace jsoncons {
                         if (JSONCONS_LIKELY(!bloom_may_contain(bloom, h)))
                         {
                             data_.emplace_back(key_type(key.begin(), key.end(),get_allocator()), get_value(*it));
+                            index_last();
                             bloom_set(bloom, h);
                         }
                         else
@@ -450,6 +467,7 @@ namespace jsoncons {
             {
                 const auto& key = get_key(*it);
                 data_.emplace_back(key_type(key.begin(), key.end(),get_allocator()), get_value(*it));
+                index_last();
             }
         }
    
@@ -461,6 +479,7 @@ namespace jsoncons {
             if (it == data_.end())
             {
                 data_.emplace_back(key_type(name.begin(), name.end()), std::forward<T>(value));
+                index_last();
                 auto pos = data_.begin() + (data_.size() - 1);
                 return std::make_pair(pos, true);
             }
@@ -479,6 +498,7 @@ namespace jsoncons {
             if (it == data_.end())
             {
                 data_.emplace_back(key_type(name.begin(),name.end(),get_allocator()), std::forward<T>(value));
+                index_last();
                 auto pos = data_.begin() + (data_.size()-1);
                 return std::make_pair(pos,true);
             }
@@ -504,6 +524,7 @@ namespace jsoncons {
                 if (it == data_.end())
                 {
                     data_.emplace_back(key_type(key.begin(), key.end()), std::forward<T>(value));
+                    index_last();
                     auto pos = data_.begin() + (data_.size() - 1);
                     return pos;
                 }
@@ -530,6 +551,7 @@ namespace jsoncons {
                 if (it == data_.end())
                 {
                     data_.emplace_back(key_type(key.begin(),key.end(),get_allocator()), std::forward<T>(value));
+                    index_last();
                     auto pos = data_.begin() + (data_.size()-1);
                     return pos;
                 }
@@ -684,6 +706,7 @@ namespace jsoncons {
             if (it == data_.end())
             {
                 data_.emplace_back(key_type(name.begin(), name.end()), std::forward<Args>(args)...);
+                index_last();
                 auto pos = data_.begin() + (data_.size()-1);
                 return std::make_pair(pos,true);
             }
@@ -702,7 +725,8 @@ namespace jsoncons {
             {
                 data_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                     std::forward<Args>(args)...);
-                auto pos = data_.begin() + data_.size();
+                index_last();
+                auto pos = data_.begin() + (data_.size()-1);
                 return std::make_pair(pos,true);
             }
             else
@@ -727,7 +751,8 @@ namespace jsoncons {
                 {
                     data_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                         std::forward<Args>(args)...);
-                    auto pos = data_.begin() + data_.size();
+                    index_last();
+                    auto pos = data_.begin() + (data_.size()-1);
                     return pos;
                 }
                 else
@@ -753,7 +778,8 @@ namespace jsoncons {
                 {
                     data_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
                         std::forward<Args>(args)...);
-                    auto pos = data_.begin() + data_.size();
+                    index_last();
+                    auto pos = data_.begin() + (data_.size()-1);
                     return pos;
                 }
                 else
@@ -776,6 +802,10 @@ namespace jsoncons {
 
         iterator find(iterator hint, const string_view_type& name) noexcept
         {
+            if (!index_.empty())
+            {
+                return find(name);
+            }
             bool found = false;
             auto it = hint;
             while (!found && it != data_.end())
@@ -792,6 +822,73 @@ namespace jsoncons {
             return found ? it : find(name);
         }
 
+        // Position of the member with the key, or size() if there is none
+        std::size_t find_pos(const string_view_type& key) const noexcept
+        {
+            if (index_.empty())
+            {
+                const std::size_t length = data_.size();
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    if (data_[i].key() == key)
+                    {
+                        return i;
+                    }
+                }
+                return length;
+            }
+            const std::size_t pos = index_.find(index_type::hash(key.data(), key.size()),
+                [&](std::size_t i) -> bool {return data_[i].key() == key;});
+            return pos == index_type::npos ? data_.size() : pos;
+        }
+
+        uint32_t hash_at(std::size_t pos) const noexcept
+        {
+            return index_type::hash(data_[pos].key().data(), data_[pos].key().size());
+        }
+
+        void rebuild_index()
+        {
+            index_.reset(index_type::capacity_for(data_.size()));
+            for (std::size_t pos = 0; pos < data_.size(); ++pos)
+            {
+                index_.insert(hash_at(pos), pos);
+            }
+        }
+
+        // Indexes the member just appended, building the index once the object outgrows a linear search
+        void index_last()
+        {
+            if (!index_.empty())
+            {
+                if (index_type::capacity_for(data_.size()) > index_.capacity())
+                {
+                    rebuild_index();
+                }
+                else
+                {
+                    index_.insert(hash_at(data_.size() - 1), data_.size() - 1);
+                }
+            }
+            else if (data_.size() > index_threshold)
+            {
+                rebuild_index();
+            }
+        }
+
+        // Drops the members in [first,last), which are about to be erased, from the index
+        void unindex(std::size_t first, std::size_t last) noexcept
+        {
+            if (!index_.empty())
+            {
+                for (std::size_t pos = first; pos < last; ++pos)
+                {
+                    index_.remove(hash_at(pos), pos);
+                }
+                index_.shift_down(first, last);
+            }
+        }
+
         void flatten_and_destroy() noexcept
         {
             if (!data_.empty())
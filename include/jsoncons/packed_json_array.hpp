@@ -0,0 +1,805 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PACKED_JSON_ARRAY_HPP
+#define JSONCONS_PACKED_JSON_ARRAY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <initializer_list>
+#include <iterator> // std::iterator_traits
+#include <memory> // std::allocator
+#include <system_error>
+#include <thread> // std::this_thread::yield
+#include <type_traits> // std::enable_if
+#include <utility> // std::move
+#include <vector>
+
+#include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/detail/span.hpp>
+#include <jsoncons/json_type.hpp>
+#include <jsoncons/semantic_tag.hpp>
+#include <jsoncons/ser_utils.hpp>
+#include <jsoncons/utility/more_type_traits.hpp>
+
+namespace jsoncons {
+
+    // packed_json_array
+
+    // A json_array that can hold an array of numbers of one kind, int64, uint64, double, float or
+    // half precision, in one contiguous buffer instead of as elements. size, copying, serializing,
+    // and conversion to a std::vector of the same number type work on the buffer.
+    //
+    // The elements are created from the buffer the first time they are accessed. Const access
+    // keeps the buffer, and creates the elements at most once even with concurrent readers;
+    // non-const access, which may modify the elements, frees the buffer.
+    template <typename Json,template <typename,typename> class SequenceContainer = std::vector>
+    class packed_json_array : public allocator_holder<typename Json::allocator_type>
+    {
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using value_type = Json;
+
+        // Smallest array that json_decoder packs
+        static constexpr std::size_t min_packed_size = 16;
+    private:
+        using value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<value_type>;
+        using value_container_type = SequenceContainer<value_type,value_allocator_type>;
+        using word_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint64_t>;
+        using word_container_type = std::vector<uint64_t,word_allocator_type>;
+
+        enum class packed_kind : uint8_t {none, int64, uint64, float64, float32, half};
+
+        // generic: the elements are in data_, there is no buffer
+        // packed: the elements are in words_ only
+        // expanding: a const accessor is creating the elements in data_ from words_
+        // expanded: the elements are in words_ and in data_
+        enum : uint8_t {generic_state, packed_state, expanding_state, expanded_state};
+
+        mutable value_container_type data_;
+        word_container_type words_;
+        std::size_t packed_size_{0};
+        packed_kind kind_{packed_kind::none};
+        mutable std::atomic<uint8_t> state_{generic_state};
+    public:
+        using iterator = typename value_container_type::iterator;
+        using const_iterator = typename value_container_type::const_iterator;
+        using reference = typename std::iterator_traits<iterator>::reference;
+        using const_reference = typename std::iterator_traits<const_iterator>::reference;
+
+        using allocator_holder<allocator_type>::get_allocator;
+
+        packed_json_array()
+        {
+        }
+
+        explicit packed_json_array(const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(value_allocator_type(alloc)),
+              words_(word_allocator_type(alloc))
+        {
+        }
+
+        explicit packed_json_array(std::size_t n,
+                            const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(n,Json(),value_allocator_type(alloc)),
+              words_(word_allocator_type(alloc))
+        {
+        }
+
+        explicit packed_json_array(std::size_t n,
+                            const Json& value,
+                            const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(n,value,value_allocator_type(alloc)),
+              words_(word_allocator_type(alloc))
+        {
+        }
+
+        template <typename InputIterator>
+        packed_json_array(InputIterator begin, InputIterator end, const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(begin,end,value_allocator_type(alloc)),
+              words_(word_allocator_type(alloc))
+        {
+        }
+
+        packed_json_array(const packed_json_array& other)
+            : packed_json_array(other, other.get_allocator())
+        {
+        }
+
+        packed_json_array(const packed_json_array& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(value_allocator_type(alloc)),
+              words_(word_allocator_type(alloc))
+        {
+            if (other.is_packed())
+            {
+                words_ = other.words_;
+                packed_size_ = other.packed_size_;
+                kind_ = other.kind_;
+                state_.store(packed_state, std::memory_order_relaxed);
+            }
+            else
+            {
+                data_ = other.data_;
+            }
+        }
+
+        packed_json_array(packed_json_array&& other) noexcept
+            : allocator_holder<allocator_type>(other.get_allocator()),
+              data_(std::move(other.data_)),
+              words_(std::move(other.words_)),
+              packed_size_(other.packed_size_),
+              kind_(other.kind_),
+              state_(other.state_.load(std::memory_order_relaxed))
+        {
+            other.reset_packed();
+        }
+
+        packed_json_array(packed_json_array&& other, const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc),
+              data_(std::move(other.data_),value_allocator_type(alloc)),
+              words_(std::move(other.words_),word_allocator_type(alloc)),
+              packed_size_(other.packed_size_),
+              kind_(other.kind_),
+              state_(other.state_.load(std::memory_order_relaxed))
+        {
+            other.reset_packed();
+        }
+
+        packed_json_array(const std::initializer_list<Json>& init,
+                   const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc),
+              data_(init,value_allocator_type(alloc)),
+              words_(word_allocator_type(alloc))
+        {
+        }
+
+        ~packed_json_array() noexcept
+        {
+            flatten_and_destroy();
+        }
+
+        // True if the elements are held in a packed buffer, they may also have been created
+        bool is_packed() const noexcept
+        {
+            return state_.load(std::memory_order_acquire) != generic_state;
+        }
+
+        // Replaces the elements with the numbers in s. Smaller integer types are widened.
+        template <typename T>
+        void assign_packed(const jsoncons::span<const T>& s)
+        {
+            assign_packed_(s.data(), s.size(), kind_of<T>());
+        }
+
+        void assign_packed(half_arg_t, const jsoncons::span<const uint16_t>& s)
+        {
+            assign_packed_(s.data(), s.size(), packed_kind::half);
+        }
+
+        // Packs the values of items, which must be numbers of the same storage kind without
+        // semantic tags. Returns false, leaving this array unchanged, if they are not.
+        template <typename Item>
+        bool try_pack(Item* items, std::size_t count)
+        {
+            if (count == 0)
+            {
+                return false;
+            }
+            packed_kind kind = packed_kind_of(items[0].value);
+            if (kind == packed_kind::none)
+            {
+                return false;
+            }
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                if (items[i].value.storage_kind() != items[0].value.storage_kind() || items[i].value.tag() != semantic_tag::none)
+                {
+                    return false;
+                }
+            }
+            word_container_type words(words_for(count, kind), 0, words_.get_allocator());
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const Json& val = items[i].value;
+                switch (kind)
+                {
+                    case packed_kind::int64:
+                        put(words, i, val.template as<int64_t>());
+                        break;
+                    case packed_kind::uint64:
+                        put(words, i, val.template as<uint64_t>());
+                        break;
+                    case packed_kind::float64:
+                        put(words, i, val.template as<double>());
+                        break;
+                    default:
+                        put(words, i, val.template cast<typename Json::half_storage>().value());
+                        break;
+                }
+            }
+            data_.clear();
+            words_.swap(words);
+            packed_size_ = count;
+            kind_ = kind;
+            state_.store(packed_state, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Copies a packed buffer of numbers of type T into v, returns false if this array
+        // does not hold one
+        template <typename T,typename Alloc>
+        typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T,bool>::value,bool>::type
+        copy_packed(std::vector<T,Alloc>& v) const
+        {
+            if (!is_packed() || kind_of<T>() != kind_ || sizeof(T) != size_of(kind_))
+            {
+                return false;
+            }
+            v.resize(packed_size_);
+            if (packed_size_ > 0)
+            {
+                std::memcpy(v.data(), words_.data(), packed_size_*sizeof(T));
+            }
+            return true;
+        }
+
+        // Sends the elements of a packed array to a visitor
+        template <typename Visitor>
+        void dump_packed(Visitor& visitor, std::error_code& ec) const
+        {
+            const ser_context context{};
+            for (std::size_t i = 0; i < packed_size_ && !ec; ++i)
+            {
+                switch (kind_)
+                {
+                    case packed_kind::int64:
+                        visitor.int64_value(get<int64_t>(i), semantic_tag::none, context, ec);
+                        break;
+                    case packed_kind::uint64:
+                        visitor.uint64_value(get<uint64_t>(i), semantic_tag::none, context, ec);
+                        break;
+                    case packed_kind::float64:
+                        visitor.double_value(get<double>(i), semantic_tag::none, context, ec);
+                        break;
+                    case packed_kind::float32:
+                        visitor.double_value(get<float>(i), semantic_tag::none, context, ec);
+                        break;
+                    case packed_kind::half:
+                        visitor.half_value(get<uint16_t>(i), semantic_tag::none, context, ec);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        reference back()
+        {
+            unpack();
+            return data_.back();
+        }
+
+        const_reference back() const
+        {
+            expand();
+            return data_.back();
+        }
+
+        void pop_back()
+        {
+            unpack();
+            data_.pop_back();
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        void swap(packed_json_array& other) noexcept
+        {
+            data_.swap(other.data_);
+            words_.swap(other.words_);
+            std::swap(packed_size_, other.packed_size_);
+            std::swap(kind_, other.kind_);
+            uint8_t state = state_.load(std::memory_order_relaxed);
+            state_.store(other.state_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            other.state_.store(state, std::memory_order_relaxed);
+        }
+
+        std::size_t size() const
+        {
+            return is_packed() ? packed_size_ : data_.size();
+        }
+
+        std::size_t capacity() const
+        {
+            return is_packed() ? packed_size_ : data_.capacity();
+        }
+
+        // Direct access to data
+        value_type* data()
+        {
+            unpack();
+            return data_.data();
+        }
+
+        const value_type* data() const
+        {
+            expand();
+            return data_.data();
+        }
+
+        void clear()
+        {
+            reset_packed();
+            data_.clear();
+        }
+
+        // Frees any elements created from a packed buffer
+        void shrink_to_fit()
+        {
+            if (is_packed())
+            {
+                value_container_type(data_.get_allocator()).swap(data_);
+                words_.shrink_to_fit();
+                state_.store(packed_state, std::memory_order_relaxed);
+            }
+            else
+            {
+                for (std::size_t i = 0; i < data_.size(); ++i)
+                {
+                    data_[i].shrink_to_fit();
+                }
+                data_.shrink_to_fit();
+            }
+        }
+
+        void reserve(std::size_t n)
+        {
+            unpack();
+            data_.reserve(n);
+        }
+
+        void resize(std::size_t n)
+        {
+            unpack();
+            data_.resize(n);
+        }
+
+        void resize(std::size_t n, const Json& val)
+        {
+            unpack();
+            data_.resize(n,val);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            unpack();
+            return data_.erase(pos);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            unpack();
+            return data_.erase(first,last);
+        }
+
+        Json& operator[](std::size_t i)
+        {
+            unpack();
+            return data_[i];
+        }
+
+        const Json& operator[](std::size_t i) const
+        {
+            expand();
+            return data_[i];
+        }
+
+        // push_back
+
+        template <typename T,typename A=allocator_type>
+        typename std::enable_if<std::allocator_traits<A>::is_always_equal::value,void>::type
+        push_back(T&& value)
+        {
+            unpack();
+            data_.emplace_back(std::forward<T>(value));
+        }
+
+        template <typename T,typename A=allocator_type>
+        typename std::enable_if<!std::allocator_traits<A>::is_always_equal::value,void>::type
+        push_back(T&& value)
+        {
+            unpack();
+            data_.emplace_back(std::forward<T>(value));
+        }
+
+        template <typename T,typename A=allocator_type>
+        typename std::enable_if<std::allocator_traits<A>::is_always_equal::value,iterator>::type
+        insert(const_iterator pos, T&& value)
+        {
+            unpack();
+            return data_.emplace(pos, std::forward<T>(value));
+        }
+        template <typename T,typename A=allocator_type>
+        typename std::enable_if<!std::allocator_traits<A>::is_always_equal::value,iterator>::type
+        insert(const_iterator pos, T&& value)
+        {
+            unpack();
+            return data_.emplace(pos, std::forward<T>(value));
+        }
+
+        template <typename InputIt>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            unpack();
+            return data_.insert(pos, first, last);
+        }
+
+        template <typename A=allocator_type,typename... Args>
+        typename std::enable_if<std::allocator_traits<A>::is_always_equal::value,iterator>::type
+        emplace(const_iterator pos, Args&&... args)
+        {
+            unpack();
+            return data_.emplace(pos, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        Json& emplace_back(Args&&... args)
+        {
+            unpack();
+            data_.emplace_back(std::forward<Args>(args)...);
+            return data_.back();
+        }
+
+        iterator begin()
+        {
+            unpack();
+            return data_.begin();
+        }
+
+        iterator end()
+        {
+            unpack();
+            return data_.end();
+        }
+
+        const_iterator begin() const
+        {
+            expand();
+            return data_.begin();
+        }
+
+        const_iterator end() const
+        {
+            expand();
+            return data_.end();
+        }
+
+        bool operator==(const packed_json_array& rhs) const
+        {
+            if (is_packed() && rhs.is_packed() && kind_ == rhs.kind_ &&
+                (kind_ == packed_kind::int64 || kind_ == packed_kind::uint64))
+            {
+                return packed_size_ == rhs.packed_size_ && words_ == rhs.words_;
+            }
+            expand();
+            rhs.expand();
+            return data_ == rhs.data_;
+        }
+
+        bool operator<(const packed_json_array& rhs) const
+        {
+            expand();
+            rhs.expand();
+            return data_ < rhs.data_;
+        }
+
+        packed_json_array& operator=(const packed_json_array& other)
+        {
+            if (this != &other)
+            {
+                if (other.is_packed())
+                {
+                    words_ = other.words_;
+                    data_.clear();
+                    packed_size_ = other.packed_size_;
+                    kind_ = other.kind_;
+                    state_.store(packed_state, std::memory_order_relaxed);
+                }
+                else
+                {
+                    data_ = other.data_;
+                    reset_packed();
+                }
+            }
+            return *this;
+        }
+    private:
+
+        template <typename T>
+        static constexpr packed_kind kind_of() noexcept
+        {
+            return std::is_same<T,double>::value ? packed_kind::float64
+                 : std::is_same<T,float>::value ? packed_kind::float32
+                 : !std::is_integral<T>::value || std::is_same<T,bool>::value ? packed_kind::none
+                 : std::is_signed<T>::value ? packed_kind::int64 : packed_kind::uint64;
+        }
+
+        static packed_kind packed_kind_of(const Json& val) noexcept
+        {
+            if (val.tag() != semantic_tag::none)
+            {
+                return packed_kind::none;
+            }
+            switch (val.storage_kind())
+            {
+                case json_storage_kind::int64:
+                    return packed_kind::int64;
+                case json_storage_kind::uint64:
+                    return packed_kind::uint64;
+                case json_storage_kind::float64:
+                    return packed_kind::float64;
+                case json_storage_kind::half_float:
+                    return packed_kind::half;
+                default:
+                    return packed_kind::none;
+            }
+        }
+
+        static std::size_t size_of(packed_kind kind) noexcept
+        {
+            switch (kind)
+            {
+                case packed_kind::float32:
+                    return sizeof(float);
+                case packed_kind::half:
+                    return sizeof(uint16_t);
+                default:
+                    return sizeof(uint64_t);
+            }
+        }
+
+        static std::size_t words_for(std::size_t count, packed_kind kind) noexcept
+        {
+            return (count*size_of(kind) + sizeof(uint64_t) - 1)/sizeof(uint64_t);
+        }
+
+        template <typename T>
+        static void put(word_container_type& words, std::size_t i, T value) noexcept
+        {
+            std::memcpy(reinterpret_cast<char*>(words.data()) + i*sizeof(T), &value, sizeof(T));
+        }
+
+        template <typename T>
+        T get(std::size_t i) const noexcept
+        {
+            T value;
+            std::memcpy(&value, reinterpret_cast<const char*>(words_.data()) + i*sizeof(T), sizeof(T));
+            return value;
+        }
+
+        template <typename T>
+        void assign_packed_(const T* p, std::size_t count, packed_kind kind)
+        {
+            word_container_type words(words_for(count, kind), 0, words_.get_allocator());
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                switch (kind)
+                {
+                    case packed_kind::int64:
+                        put(words, i, static_cast<int64_t>(p[i]));
+                        break;
+                    case packed_kind::uint64:
+                        put(words, i, static_cast<uint64_t>(p[i]));
+                        break;
+                    default:
+                        put(words, i, p[i]);
+                        break;
+                }
+            }
+            data_.clear();
+            words_.swap(words);
+            packed_size_ = count;
+            kind_ = kind;
+            state_.store(packed_state, std::memory_order_relaxed);
+        }
+
+        void reset_packed() noexcept
+        {
+            word_container_type(words_.get_allocator()).swap(words_);
+            packed_size_ = 0;
+            kind_ = packed_kind::none;
+            state_.store(generic_state, std::memory_order_relaxed);
+        }
+
+        void create_elements() const
+        {
+            data_.reserve(packed_size_);
+            for (std::size_t i = 0; i < packed_size_; ++i)
+            {
+                switch (kind_)
+                {
+                    case packed_kind::int64:
+                        data_.emplace_back(get<int64_t>(i), semantic_tag::none);
+                        break;
+                    case packed_kind::uint64:
+                        data_.emplace_back(get<uint64_t>(i), semantic_tag::none);
+                        break;
+                    case packed_kind::float64:
+                        data_.emplace_back(get<double>(i), semantic_tag::none);
+                        break;
+                    case packed_kind::float32:
+                        data_.emplace_back(static_cast<double>(get<float>(i)), semantic_tag::none);
+                        break;
+                    default:
+                        data_.emplace_back(half_arg, get<uint16_t>(i), semantic_tag::none);
+                        break;
+                }
+            }
+        }
+
+        // Creates the elements of a packed array for const access. One reader creates them,
+        // concurrent readers wait for it to finish.
+        void expand() const
+        {
+            while (true)
+            {
+                uint8_t state = state_.load(std::memory_order_acquire);
+                if (state == generic_state || state == expanded_state)
+                {
+                    return;
+                }
+                if (state == packed_state)
+                {
+                    if (state_.compare_exchange_weak(state, expanding_state, std::memory_order_acquire))
+                    {
+                        JSONCONS_TRY
+                        {
+                            create_elements();
+                        }
+                        JSONCONS_CATCH(...)
+                        {
+                            data_.clear();
+                            state_.store(packed_state, std::memory_order_release);
+                            JSONCONS_RETHROW;
+                        }
+                        state_.store(expanded_state, std::memory_order_release);
+                        return;
+                    }
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        // Converts a packed array to elements before non-const access
+        void unpack()
+        {
+            uint8_t state = state_.load(std::memory_order_relaxed);
+            if (state == generic_state)
+            {
+                return;
+            }
+            if (state == packed_state)
+            {
+                data_.clear();
+                JSONCONS_TRY
+                {
+                    create_elements();
+                }
+                JSONCONS_CATCH(...)
+                {
+                    data_.clear();
+                    JSONCONS_RETHROW;
+                }
+            }
+            reset_packed();
+        }
+
+        void flatten_and_destroy() noexcept
+        {
+            while (!data_.empty())
+            {
+                value_type current = std::move(data_.back());
+                data_.pop_back();
+                switch (current.storage_kind())
+                {
+                    case json_storage_kind::array:
+                    {
+                        // A packed array has no nested arrays or objects
+                        if (current.template cast<typename Json::array_storage>().value().is_packed())
+                        {
+                            break;
+                        }
+                        for (auto&& item : current.array_range())
+                        {
+                            if ((item.storage_kind() == json_storage_kind::array || item.storage_kind() == json_storage_kind::object)
+                                && !item.empty()) // non-empty object or array
+                            {
+                                data_.push_back(std::move(item));
+                            }
+                        }
+                        current.clear();
+                        break;
+                    }
+                    case json_storage_kind::object:
+                    {
+                        for (auto&& kv : current.object_range())
+                        {
+                            if ((kv.value().storage_kind() == json_storage_kind::array || kv.value().storage_kind() == json_storage_kind::object)
+                                && !kv.value().empty()) // non-empty object or array
+                            {
+                                data_.push_back(std::move(kv.value()));
+                            }
+                        }
+                        current.clear();
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+        }
+    };
+
+namespace detail {
+
+    template <typename Array>
+    using is_packed_t = decltype(std::declval<const Array&>().is_packed());
+
+    template <typename Array>
+    using has_packed_storage = ext_traits::is_detected<is_packed_t, Array>;
+
+    // Packs the values of items into the array arr if its array type supports it and they
+    // are numbers of the same kind
+    template <typename Json,typename Item>
+    typename std::enable_if<has_packed_storage<typename Json::array>::value,bool>::type
+    try_pack_array(Json& arr, Item* items, std::size_t count)
+    {
+        return count >= Json::array::min_packed_size &&
+            arr.template cast<typename Json::array_storage>().value().try_pack(items, count);
+    }
+
+    template <typename Json,typename Item>
+    typename std::enable_if<!has_packed_storage<typename Json::array>::value,bool>::type
+    try_pack_array(Json&, Item*, std::size_t)
+    {
+        return false;
+    }
+
+    // Copies the packed numbers of the array j into v, returns false if j does not hold
+    // packed numbers of type T
+    template <typename Json,typename T,typename Alloc>
+    typename std::enable_if<has_packed_storage<typename Json::array>::value &&
+        std::is_arithmetic<T>::value && !std::is_same<T,bool>::value,bool>::type
+    try_copy_packed(const Json& j, std::vector<T,Alloc>& v)
+    {
+        return j.storage_kind() == json_storage_kind::array &&
+            j.template cast<typename Json::array_storage>().value().copy_packed(v);
+    }
+
+    template <typename Json,typename Container>
+    bool try_copy_packed(const Json&, Container&)
+    {
+        return false;
+    }
+
+} // namespace detail
+
+} // namespace jsoncons
+
+#endif // JSONCONS_PACKED_JSON_ARRAY_HPP
@@ -0,0 +1,382 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PARALLEL_PARSE_HPP
+#define JSONCONS_PARALLEL_PARSE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/simd.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_index_parser.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+
+namespace jsoncons {
+
+    class parallel_parse_options
+    {
+        std::size_t num_threads_{0};
+        std::size_t min_chunk_size_{1 << 20};
+    public:
+        parallel_parse_options() = default;
+
+        // Number of threads, 0 for std::thread::hardware_concurrency()
+        std::size_t num_threads() const
+        {
+            if (num_threads_ != 0)
+            {
+                return num_threads_;
+            }
+            std::size_t n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+        }
+
+        parallel_parse_options& num_threads(std::size_t value)
+        {
+            num_threads_ = value;
+            return *this;
+        }
+
+        // Smallest number of bytes given to a thread. Text shorter than twice this
+        // is parsed on the calling thread.
+        std::size_t min_chunk_size() const
+        {
+            return min_chunk_size_;
+        }
+
+        parallel_parse_options& min_chunk_size(std::size_t value)
+        {
+            min_chunk_size_ = value < 64 ? 64 : value;
+            return *this;
+        }
+    };
+
+namespace detail {
+
+    // Calls f(0), ..., f(n-1) concurrently, f(0) on the calling thread, and rethrows
+    // the first exception thrown by any of the calls. Calls for which no thread could be
+    // started also run on the calling thread.
+    template <typename F>
+    void parallel_for(std::size_t n, F f)
+    {
+        std::vector<std::exception_ptr> exceptions(n);
+        auto call = [&f, &exceptions](std::size_t i)
+        {
+            JSONCONS_TRY
+            {
+                f(i);
+            }
+            JSONCONS_CATCH(...)
+            {
+                exceptions[i] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        JSONCONS_TRY
+        {
+            threads.reserve(n > 0 ? n - 1 : 0);
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                threads.emplace_back(call, i);
+            }
+        }
+        JSONCONS_CATCH(...)
+        {
+        }
+        if (n > 0)
+        {
+            call(0);
+        }
+        for (std::size_t i = threads.size() + 1; i < n; ++i)
+        {
+            call(i);
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        for (auto& e : exceptions)
+        {
+            if (e)
+            {
+                std::rethrow_exception(e);
+            }
+        }
+    }
+
+    // Quote aware structural scan of a chunk of a top level array. The nesting depth is
+    // tracked relative to the start of the chunk, and first_commas[i] is the offset of the
+    // first comma at relative depth -i, or npos.
+    struct array_chunk_scan
+    {
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        uint64_t exit_escaped{0};
+        uint64_t exit_in_string{0};
+        int64_t depth_change{0};
+        std::vector<std::size_t> first_commas;
+
+        // Scans [first,last). Every block but the last must be a full 64 bytes.
+        void scan(const char* first, const char* last, uint64_t escaped_in, uint64_t in_string_in)
+        {
+            first_commas.clear();
+
+            uint64_t prev_escaped = escaped_in;
+            uint64_t prev_in_string = in_string_in;
+            int64_t depth = 0;
+            const std::size_t length = static_cast<std::size_t>(last - first);
+
+            char padded[64];
+            for (std::size_t offset = 0; offset < length; offset += 64)
+            {
+                const char* block = first + offset;
+                if (length - offset < 64)
+                {
+                    std::memset(padded, ' ', sizeof(padded));
+                    std::memcpy(padded, block, length - offset);
+                    block = padded;
+                }
+                const auto cls = detail::simd::classify_block(block);
+
+                const uint64_t escaped = detail::find_escaped(cls.backslashes, prev_escaped);
+                const uint64_t quotes = cls.quotes & ~escaped;
+                const uint64_t in_string = detail::prefix_xor(quotes) ^ prev_in_string;
+                prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+                uint64_t ops = cls.ops & ~in_string;
+                while (ops != 0)
+                {
+                    const unsigned i = detail::simd::ctz64(ops);
+                    switch (block[i])
+                    {
+                        case '[': case '{':
+                            ++depth;
+                            break;
+                        case ']': case '}':
+                            --depth;
+                            break;
+                        case ',':
+                            if (depth <= 0)
+                            {
+                                const std::size_t level = static_cast<std::size_t>(-depth);
+                                if (level >= first_commas.size())
+                                {
+                                    first_commas.resize(level + 1, npos);
+                                }
+                                if (first_commas[level] == npos)
+                                {
+                                    first_commas[level] = offset + i;
+                                }
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    ops &= ops - 1;
+                }
+            }
+            exit_escaped = prev_escaped;
+            exit_in_string = prev_in_string;
+            depth_change = depth;
+        }
+    };
+
+    // Splits the elements of the top level array [first,last) into ranges separated by
+    // commas directly inside it. first is just past the opening bracket and last is the
+    // closing bracket. Each chunk is scanned on its own thread assuming that it starts
+    // outside a string; a chunk whose guess turns out wrong is scanned again with the
+    // state carried from the previous chunk.
+    inline std::vector<std::pair<std::size_t,std::size_t>> split_array_elements(const char* first, const char* last,
+        std::size_t num_chunks)
+    {
+        const std::size_t length = static_cast<std::size_t>(last - first);
+        std::size_t chunk_size = (length + num_chunks - 1) / num_chunks;
+        chunk_size = (chunk_size + 63) & ~static_cast<std::size_t>(63);
+        num_chunks = (length + chunk_size - 1) / chunk_size;
+
+        std::vector<array_chunk_scan> scans(num_chunks);
+        parallel_for(num_chunks, [&](std::size_t k)
+        {
+            const char* chunk_first = first + k*chunk_size;
+            const char* chunk_last = (k + 1 == num_chunks) ? last : chunk_first + chunk_size;
+            scans[k].scan(chunk_first, chunk_last, 0, 0);
+        });
+
+        std::vector<std::pair<std::size_t,std::size_t>> ranges;
+        std::size_t range_start = 0;
+        int64_t depth = 1;
+        for (std::size_t k = 0; k < num_chunks; ++k)
+        {
+            if (k > 0)
+            {
+                const array_chunk_scan& prev = scans[k-1];
+                if (prev.exit_escaped != 0 || prev.exit_in_string != 0)
+                {
+                    const char* chunk_first = first + k*chunk_size;
+                    const char* chunk_last = (k + 1 == num_chunks) ? last : chunk_first + chunk_size;
+                    scans[k].scan(chunk_first, chunk_last, prev.exit_escaped, prev.exit_in_string);
+                }
+                depth += prev.depth_change;
+                const auto& commas = scans[k].first_commas;
+                if (depth >= 1 && static_cast<std::size_t>(depth - 1) < commas.size() &&
+                    commas[static_cast<std::size_t>(depth - 1)] != array_chunk_scan::npos)
+                {
+                    const std::size_t pos = k*chunk_size + commas[static_cast<std::size_t>(depth - 1)];
+                    ranges.emplace_back(range_start, pos);
+                    range_start = pos + 1;
+                }
+            }
+        }
+        ranges.emplace_back(range_start, length);
+        return ranges;
+    }
+
+    // Parses the comma separated elements in [first,last) as if enclosed in brackets
+    template <typename Json>
+    bool parse_array_elements(const typename Json::char_type* first, const typename Json::char_type* last,
+        const basic_json_decode_options<typename Json::char_type>& options, Json& result)
+    {
+        using char_type = typename Json::char_type;
+
+        static const char_type open_bracket[1] = {'['};
+        static const char_type close_bracket[1] = {']'};
+
+        std::error_code ec;
+        json_decoder<Json> decoder;
+        basic_json_parser<char_type> parser(options);
+
+        parser.update(open_bracket, 1);
+        parser.parse_some(decoder, ec);
+        if (!ec)
+        {
+            parser.update(first, static_cast<std::size_t>(last - first));
+            parser.parse_some(decoder, ec);
+        }
+        if (!ec)
+        {
+            parser.update(close_bracket, 1);
+            parser.parse_some(decoder, ec);
+        }
+        if (!ec)
+        {
+            parser.finish_parse(decoder, ec);
+        }
+        if (!ec)
+        {
+            parser.check_done(ec);
+        }
+        if (ec || !decoder.is_valid())
+        {
+            return false;
+        }
+        result = decoder.get_result();
+        return true;
+    }
+
+} // namespace detail
+
+    // Parses JSON text that is entirely in memory. When the text is a large top level
+    // array, its elements are split into ranges that are parsed on separate threads and
+    // then moved into one array. Any other text, and any text for which the parallel
+    // parse fails, is parsed sequentially with Json::parse, which also reports errors.
+
+    template <typename Json>
+    Json parallel_parse(const typename Json::char_type* data, std::size_t length,
+        const parallel_parse_options& parallel_options = parallel_parse_options{},
+        const basic_json_decode_options<typename Json::char_type>& options = basic_json_options<typename Json::char_type>())
+    {
+        using char_type = typename Json::char_type;
+        static_assert(sizeof(char_type) == sizeof(char), "parallel_parse requires UTF-8 input");
+
+        std::size_t num_chunks = length / parallel_options.min_chunk_size();
+        if (num_chunks > parallel_options.num_threads())
+        {
+            num_chunks = parallel_options.num_threads();
+        }
+        // A trailing comma accepted inside one range would hide an empty element
+        if (num_chunks < 2 || options.allow_trailing_comma())
+        {
+            return Json::parse(data, length, options);
+        }
+
+        const char* first = reinterpret_cast<const char*>(data);
+        const char* last = first + length;
+        while (first < last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
+        {
+            ++first;
+        }
+        while (first < last && (*(last-1) == ' ' || *(last-1) == '\t' || *(last-1) == '\n' || *(last-1) == '\r'))
+        {
+            --last;
+        }
+        if (last - first < 2 || *first != '[' || *(last-1) != ']')
+        {
+            return Json::parse(data, length, options);
+        }
+        ++first;
+        --last;
+
+        auto ranges = detail::split_array_elements(first, last, num_chunks);
+        if (ranges.size() < 2)
+        {
+            return Json::parse(data, length, options);
+        }
+
+        std::vector<Json> parts(ranges.size());
+        std::vector<char> ok(ranges.size(), 0);
+        detail::parallel_for(ranges.size(), [&](std::size_t k)
+        {
+            const char_type* range_first = reinterpret_cast<const char_type*>(first + ranges[k].first);
+            const char_type* range_last = reinterpret_cast<const char_type*>(first + ranges[k].second);
+            // Every range between two commas holds at least one element
+            ok[k] = detail::parse_array_elements(range_first, range_last, options, parts[k]) &&
+                    parts[k].is_array() && !parts[k].empty();
+        });
+        std::size_t size = 0;
+        for (std::size_t k = 0; k < parts.size(); ++k)
+        {
+            if (!ok[k])
+            {
+                return Json::parse(data, length, options);
+            }
+            size += parts[k].size();
+        }
+
+        Json result(json_array_arg);
+        result.reserve(size);
+        for (auto& part : parts)
+        {
+            for (auto& element : part.array_range())
+            {
+                result.push_back(std::move(element));
+            }
+            part = Json();
+        }
+        return result;
+    }
+
+    template <typename Json>
+    Json parallel_parse(const jsoncons::basic_string_view<typename Json::char_type>& s,
+        const parallel_parse_options& parallel_options = parallel_parse_options{},
+        const basic_json_decode_options<typename Json::char_type>& options = basic_json_options<typename Json::char_type>())
+    {
+        return parallel_parse<Json>(s.data(), s.size(), parallel_options, options);
+    }
+
+} // namespace jsoncons
+
+#endif // JSONCONS_PARALLEL_PARSE_HPP
@@ -29,6 +29,7 @@
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/json_type.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/packed_json_array.hpp>
 #include <jsoncons/semantic_tag.hpp>
 #include <jsoncons/utility/bigint.hpp>
 #include <jsoncons/utility/byte_string.hpp>
@@ -579,6 +580,10 @@ has_can_convert = ext_traits::is_detected<traits_can_convert_t, Json, T>;
                 return result_type(jsoncons::unexpect, conv_errc::not_vector);
             }
             T result{jsoncons::make_obj_using_allocator<T>(aset.get_allocator())};
+            if (jsoncons::detail::try_copy_packed(j, result))
+            {
+                return result_type(std::move(result));
+            }
             visit_reserve_(typename std::integral_constant<bool, ext_traits::has_reserve<T>::value>::type(),result,j.size());
             for (const auto& item : j.array_range())
             {
@@ -10,11 +10,13 @@
 #include <cmath>
 #include <cstdint>
 #include <cstring> // std::memcpy
+#include <iterator> // std::back_inserter
 #include <memory> // std::addressof
 #include <ostream>
 #include <vector>
 
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/utility/binary.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
 namespace jsoncons { 
@@ -115,6 +117,29 @@ namespace jsoncons {
                 *p_++ = ch;
             }
         }
+
+        // Returns room for n characters at the end of the buffer, to be followed by commit
+        CharT* prepare(std::size_t n)
+        {
+            if (std::size_t(end_buffer_ - p_) < n)
+            {
+                stream_ptr_->write(begin_buffer_, buffer_length());
+                if (buffer_.size() < n)
+                {
+                    buffer_.resize(n);
+                    begin_buffer_ = buffer_.data();
+                    end_buffer_ = begin_buffer_ + buffer_.size();
+                }
+                p_ = begin_buffer_;
+            }
+            return p_;
+        }
+
+        // Appends the first n characters written to the room returned by prepare
+        void commit(std::size_t n)
+        {
+            p_ += n;
+        }
     private:
 
         std::size_t buffer_length() const
@@ -224,6 +249,29 @@ namespace jsoncons {
                 *p_++ = ch;
             }
         }
+
+        // Returns room for n bytes at the end of the buffer, to be followed by commit
+        uint8_t* prepare(std::size_t n)
+        {
+            if (std::size_t(end_buffer_ - p_) < n)
+            {
+                stream_ptr_->write((char*)begin_buffer_, buffer_length());
+                if (buffer_.size() < n)
+                {
+                    buffer_.resize(n);
+                    begin_buffer_ = buffer_.data();
+                    end_buffer_ = begin_buffer_ + buffer_.size();
+                }
+                p_ = begin_buffer_;
+            }
+            return p_;
+        }
+
+        // Appends the first n bytes written to the room returned by prepare
+        void commit(std::size_t n)
+        {
+            p_ += n;
+        }
     private:
 
         std::size_t buffer_length() const
@@ -242,6 +290,7 @@ namespace jsoncons {
         using container_type = StringT;
     private:
         container_type* buf_ptr{nullptr};
+        std::size_t prepared_offset_{0};
     public:
 
         // Noncopyable
@@ -287,6 +336,24 @@ namespace jsoncons {
         {
             buf_ptr->push_back(ch);
         }
+
+        // Returns room for n characters at the end of the string, to be followed by commit
+        template <typename C = container_type>
+        typename std::enable_if<ext_traits::has_resize<C>::value && ext_traits::has_data<C>::value,value_type*>::type
+        prepare(std::size_t n)
+        {
+            prepared_offset_ = buf_ptr->size();
+            buf_ptr->resize(prepared_offset_ + n);
+            return &(*buf_ptr)[prepared_offset_];
+        }
+
+        // Keeps the first n characters written to the room returned by prepare
+        template <typename C = container_type>
+        typename std::enable_if<ext_traits::has_resize<C>::value && ext_traits::has_data<C>::value>::type
+        commit(std::size_t n)
+        {
+            buf_ptr->resize(prepared_offset_ + n);
+        }
     };
 
     // bytes_sink
@@ -304,6 +371,7 @@ namespace jsoncons {
         using value_type = typename Container::value_type;
     private:
         container_type* buf_ptr;
+        std::size_t prepared_offset_{0};
     public:
 
         // Noncopyable
@@ -335,6 +403,24 @@ namespace jsoncons {
             buf_ptr->push_back(static_cast<value_type>(ch));
         }
 
+        // Returns room for n bytes at the end of the container, to be followed by commit
+        template <typename C = container_type>
+        typename std::enable_if<ext_traits::has_resize<C>::value && ext_traits::has_data<C>::value,uint8_t*>::type
+        prepare(std::size_t n)
+        {
+            prepared_offset_ = buf_ptr->size();
+            buf_ptr->resize(prepared_offset_ + n);
+            return reinterpret_cast<uint8_t*>(&(*buf_ptr)[prepared_offset_]);
+        }
+
+        // Keeps the first n bytes written to the room returned by prepare
+        template <typename C = container_type>
+        typename std::enable_if<ext_traits::has_resize<C>::value && ext_traits::has_data<C>::value>::type
+        commit(std::size_t n)
+        {
+            buf_ptr->resize(prepared_offset_ + n);
+        }
+
     private:
         template <typename C>
         static auto append_impl(C& c, const uint8_t* s, std::size_t length, int)
@@ -373,6 +459,45 @@ namespace jsoncons {
         }
     };
 
+    // is_span_sink
+
+    // A sink with prepare(n), returning room for n values at its end, and commit(m), keeping 
+    // the first m of them, so that encoders can format directly into its buffer
+
+    template <typename Sink>
+    using
+    sink_prepare_t = decltype(std::declval<Sink&>().prepare(std::size_t()));
+
+    template <typename Sink>
+    using
+    sink_commit_t = decltype(std::declval<Sink&>().commit(std::size_t()));
+
+    template <typename Sink,typename Enable=void>
+    struct is_span_sink : std::false_type {};
+
+    template <typename Sink>
+    struct is_span_sink<Sink,
+        typename std::enable_if<std::is_pointer<ext_traits::is_detected_t<sink_prepare_t,Sink>>::value &&
+                                ext_traits::is_detected<sink_commit_t,Sink>::value
+    >::type> : std::true_type {};
+
+    // append_big_endian
+
+    template <typename T,typename Sink>
+    typename std::enable_if<!is_span_sink<Sink>::value>::type
+    append_big_endian(T val, Sink& sink)
+    {
+        binary::native_to_big(val, std::back_inserter(sink));
+    }
+
+    template <typename T,typename Sink>
+    typename std::enable_if<is_span_sink<Sink>::value>::type
+    append_big_endian(T val, Sink& sink)
+    {
+        binary::native_to_big(val, sink.prepare(sizeof(T)));
+        sink.commit(sizeof(T));
+    }
+
 } // namespace jsoncons
 
 #endif // JSONCONS_SINK_HPP
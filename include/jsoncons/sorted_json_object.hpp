@@ -280,14 +280,14 @@ namespace jsoncons {
                 data_.reserve(count);
 
                 std::sort(items, items+count, compare);
-                data_.emplace_back(key_type(items[0].name.data(), items[0].name.size(), get_allocator()), std::move(items[0].value));
+                data_.emplace_back(key_type(std::move(items[0].name), get_allocator()), std::move(items[0].value));
                 
                 for (std::size_t i = 1; i < count; ++i)
                 {
                     auto& item = items[i];
-                    if (item.name != items[i-1].name)
+                    if (item.name != data_.back().key())
                     {
-                        data_.emplace_back(key_type(item.name.data(), item.name.size(), get_allocator()), std::move(item.value));
+                        data_.emplace_back(key_type(std::move(item.name), get_allocator()), std::move(item.value));
                     }
                 }
             }
@@ -491,6 +491,10 @@ namespace ext_traits {
     using
     container_reserve_t = decltype(std::declval<Container>().reserve(typename Container::size_type()));
 
+    template <typename Container>
+    using
+    container_resize_t = decltype(std::declval<Container>().resize(typename Container::size_type()));
+
     template <typename Container>
     using
     container_data_t = decltype(std::declval<Container>().data());
@@ -581,6 +585,12 @@ namespace ext_traits {
     using
     has_reserve = is_detected<container_reserve_t, Container>;
 
+    // has_resize
+
+    template <typename Container>
+    using
+    has_resize = is_detected<container_resize_t, Container>;
+
     // is_back_insertable
 
     template <typename Container>
@@ -7,6 +7,7 @@
 #ifndef JSONCONS_UTILITY_READ_NUMBER_HPP
 #define JSONCONS_UTILITY_READ_NUMBER_HPP
 
+#include <algorithm>
 #include <cctype>
 #include <cstddef>
 #include <cstdint>
@@ -19,6 +20,8 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/eisel_lemire.hpp>
+#include <jsoncons/detail/simd.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
@@ -259,6 +262,40 @@ bool is_base16(const CharT* s, std::size_t length)
     return state == integer_chars_state::base16 ? true : false;
 }
     
+namespace detail {
+
+// Accumulates runs of eight decimal digits from [cur,stop) into num, stopping at the
+// first run that contains a non-digit. The caller bounds stop so that num cannot overflow.
+
+template <typename T,typename CharT>
+typename std::enable_if<sizeof(CharT) == sizeof(char) && (ext_traits::integer_limits<T>::digits10 >= 8),const CharT*>::type
+accumulate_eight_digits(const CharT* cur, const CharT* stop, T& num)
+{
+    JSONCONS_IF_CONSTEXPR (endian::native == endian::little)
+    {
+        while (stop - cur >= 8)
+        {
+            const uint64_t x = simd::swar_load(reinterpret_cast<const char*>(cur));
+            if (simd::swar_non_digits(x) != 0)
+            {
+                break;
+            }
+            num = static_cast<T>(num*T(100000000) + simd::swar_parse_eight_digits(x));
+            cur += 8;
+        }
+    }
+    return cur;
+}
+
+template <typename T,typename CharT>
+typename std::enable_if<!(sizeof(CharT) == sizeof(char) && (ext_traits::integer_limits<T>::digits10 >= 8)),const CharT*>::type
+accumulate_eight_digits(const CharT* cur, const CharT*, T&)
+{
+    return cur;
+}
+
+} // namespace detail
+
 template <typename T,typename CharT>
 typename std::enable_if<ext_traits::integer_limits<T>::is_specialized && !ext_traits::integer_limits<T>::is_signed,to_number_result<CharT>>::type
 dec_to_integer(const CharT* s, std::size_t length, T& value)
@@ -277,7 +314,8 @@ dec_to_integer(const CharT* s, std::size_t length, T& value)
     static constexpr std::size_t digits10 = static_cast<std::size_t>(ext_traits::integer_limits<T>::digits10);
     const std::size_t n = (std::min)(digits10, length);
     const CharT* stop = s + n;
-     
+
+    cur = detail::accumulate_eight_digits(cur, stop, num);
     while (cur < stop)
     {
         uint8_t d;
@@ -483,6 +521,8 @@ to_integer(const CharT* s, std::size_t length, T& n)
             {
                 static constexpr T max_value = (ext_traits::integer_limits<T>::max)();
                 static constexpr T max_value_div_10 = max_value / 10;
+                static constexpr std::size_t digits10 = static_cast<std::size_t>(ext_traits::integer_limits<T>::digits10);
+                s = detail::accumulate_eight_digits(s, s + (std::min)(digits10, static_cast<std::size_t>(end - s)), n);
                 for (; s < end; ++s)
                 {
                     T x = 0;
@@ -746,7 +786,9 @@ hex_to_integer(const CharT* s, std::size_t length, T& n)
 
 #if defined(JSONCONS_HAS_STD_FROM_CHARS) && JSONCONS_HAS_STD_FROM_CHARS
 
-inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val) 
+namespace detail {
+
+inline to_number_result<char> platform_decstr_to_double(const char* s, std::size_t length, double& val)
 {
     const char* last = s+length;
     const auto res = std::from_chars(s, last, val);
@@ -767,7 +809,7 @@ inline to_number_result<char> decstr_to_double(const char* s, std::size_t length
     return to_number_result<char>{res.ptr,res.ec};
 }
 
-inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
+inline to_number_result<wchar_t> platform_decstr_to_double(const wchar_t* s, std::size_t length, double& val)
 {
     std::string buf(length,'0');
     for (size_t i = 0; i < length; ++i)
@@ -783,9 +825,13 @@ inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t
     return to_number_result<wchar_t>{s+length,res.ec};
 }
 
+} // namespace detail
+
 #elif defined(JSONCONS_HAS_MSC_STRTOD_L)
 
-inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
+namespace detail {
+
+inline to_number_result<char> platform_decstr_to_double(const char* s, std::size_t length, double& val)
 {
     static _locale_t locale = _create_locale(LC_NUMERIC, "C");
 
@@ -803,7 +849,7 @@ inline to_number_result<char> decstr_to_double(const char* s, std::size_t length
     return to_number_result<char>{end};
 }
 
-inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
+inline to_number_result<wchar_t> platform_decstr_to_double(const wchar_t* s, std::size_t length, double& val)
 {
     static _locale_t locale = _create_locale(LC_NUMERIC, "C");
 
@@ -821,10 +867,14 @@ inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t
     return to_number_result<wchar_t>{end};
 }
 
+} // namespace detail
+
 
 #elif defined(JSONCONS_HAS_STRTOLD_L)
 
-inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
+namespace detail {
+
+inline to_number_result<char> platform_decstr_to_double(const char* s, std::size_t length, double& val)
 {
     locale_t locale = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
 
@@ -842,7 +892,7 @@ inline to_number_result<char> decstr_to_double(const char* s, std::size_t length
     return to_number_result<char>{end};
 }
 
-inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
+inline to_number_result<wchar_t> platform_decstr_to_double(const wchar_t* s, std::size_t length, double& val)
 {
     locale_t locale = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
 
@@ -860,9 +910,13 @@ inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t
     return to_number_result<wchar_t>{end};
 }
 
+} // namespace detail
+
 #else
 
-inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
+namespace detail {
+
+inline to_number_result<char> platform_decstr_to_double(const char* s, std::size_t length, double& val)
 {
     const char* cur = s+length;
     char *end = nullptr;
@@ -891,7 +945,7 @@ inline to_number_result<char> decstr_to_double(const char* s, std::size_t length
     return to_number_result<char>{str_end};
 }
 
-inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
+inline to_number_result<wchar_t> platform_decstr_to_double(const wchar_t* s, std::size_t length, double& val)
 {
     const wchar_t* cur = s+length;
     wchar_t *end = nullptr;
@@ -920,6 +974,8 @@ inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t
     return to_number_result<wchar_t>{str_end};
 }
 
+} // namespace detail
+
 inline to_number_result<char> decstr_to_double(char* s, std::size_t length)
 {
     char* cur = s+length;
@@ -974,6 +1030,30 @@ inline to_number_result<wchar_t> decstr_to_double(wchar_t* s, std::size_t length
 
 #endif
 
+// Plain decimal text is converted by detail::decimal_to_double, which is correctly
+// rounded, locale independent and does not allocate. Anything else (e.g. "inf",
+// leading '+') goes to the platform conversion.
+
+inline to_number_result<char> decstr_to_double(const char* s, std::size_t length, double& val)
+{
+    std::errc ec{};
+    if (JSONCONS_LIKELY(detail::decimal_to_double(s, length, val, ec)))
+    {
+        return to_number_result<char>{s+length, ec};
+    }
+    return detail::platform_decstr_to_double(s, length, val);
+}
+
+inline to_number_result<wchar_t> decstr_to_double(const wchar_t* s, std::size_t length, double& val)
+{
+    std::errc ec{};
+    if (JSONCONS_LIKELY(detail::decimal_to_double(s, length, val, ec)))
+    {
+        return to_number_result<wchar_t>{s+length, ec};
+    }
+    return detail::platform_decstr_to_double(s, length, val);
+}
+
 inline to_number_result<char> hexstr_to_double(const char* s, std::size_t length, double& val)
 {
     const char* cur = s+length;
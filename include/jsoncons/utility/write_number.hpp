@@ -20,10 +20,11 @@
 
 #include <jsoncons/config/compiler_support.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
-#include <jsoncons/detail/grisu3.hpp>
+#include <jsoncons/detail/schubfach.hpp>
 #include <jsoncons/utility/read_number.hpp>
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_options.hpp>
+#include <jsoncons/sink.hpp>
 #include <jsoncons/utility/more_type_traits.hpp>
 
 namespace jsoncons { 
@@ -34,51 +35,122 @@ char to_hex_character(uint8_t c)
     return (char)((c < 10) ? ('0' + c) : ('A' - 10 + c));
 }
 
-// from_integer
-
-template <typename Integer,typename Result>
-typename std::enable_if<ext_traits::is_integer<Integer>::value,std::size_t>::type
-from_integer(Integer value, Result& result)
-{
-    using char_type = typename Result::value_type;
+namespace detail {
 
-    char_type buf[255];
-    char_type *p = buf;
-    const char_type* last = buf+255;
-
-    bool is_negative = value < 0;
+    // The two digit decimal representations of 0 through 99
+    inline const char* digit_pairs()
+    {
+        static const char pairs[] = 
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+        return pairs;
+    }
 
-    if (value < 0)
+    // Writes the decimal digits of u so that they end at last, and returns the first
+    template <typename CharT,typename Unsigned>
+    CharT* write_digits_backward(Unsigned u, CharT* last)
     {
-        do
+        const char* pairs = digit_pairs();
+        CharT* p = last;
+        while (u >= 100)
+        {
+            const std::size_t i = static_cast<std::size_t>(u % 100) * 2;
+            u /= 100;
+            *--p = static_cast<CharT>(pairs[i + 1]);
+            *--p = static_cast<CharT>(pairs[i]);
+        }
+        if (u >= 10)
         {
-            *p++ = static_cast<char_type>(48 - (value % 10));
+            const std::size_t i = static_cast<std::size_t>(u) * 2;
+            *--p = static_cast<CharT>(pairs[i + 1]);
+            *--p = static_cast<CharT>(pairs[i]);
         }
-        while ((value /= 10) && (p < last));
+        else
+        {
+            *--p = static_cast<CharT>('0' + static_cast<int>(u));
+        }
+        return p;
     }
-    else
+
+    template <typename Unsigned>
+    std::size_t decimal_digit_count(Unsigned u)
     {
+        constexpr int max_digits = ext_traits::integer_limits<Unsigned>::digits10 + 1;
 
-        do
+        Unsigned power = 10;
+        for (int n = 1; n < max_digits; ++n)
         {
-            *p++ = static_cast<char_type>(48 + value % 10);
+            if (u < power)
+            {
+                return static_cast<std::size_t>(n);
+            }
+            power = static_cast<Unsigned>(power * 10);
         }
-        while ((value /= 10) && (p < last));
+        return max_digits;
     }
-    JSONCONS_ASSERT(p != last);
 
-    std::size_t count = (p - buf);
-    if (is_negative)
+    template <typename Unsigned,typename Result>
+    std::size_t write_integer(Unsigned u, bool is_negative, Result& result, std::false_type)
     {
-        result.push_back('-');
-        ++count;
+        using char_type = typename Result::value_type;
+
+        // Digits are produced from the right, two at a time
+        char_type buf[ext_traits::integer_limits<Unsigned>::digits10 + 1];
+        char_type* const last = buf + sizeof(buf)/sizeof(char_type);
+        char_type* p = write_digits_backward(u, last);
+
+        std::size_t count = static_cast<std::size_t>(last - p);
+        if (is_negative)
+        {
+            result.push_back('-');
+            ++count;
+        }
+        for (; p != last; ++p)
+        {
+            result.push_back(*p);
+        }
+        return count;
     }
-    while (--p >= buf)
+
+    // Formats straight into the sink's buffer
+    template <typename Unsigned,typename Result>
+    std::size_t write_integer(Unsigned u, bool is_negative, Result& result, std::true_type)
     {
-        result.push_back(*p);
+        using char_type = typename Result::value_type;
+
+        const std::size_t count = decimal_digit_count(u) + (is_negative ? 1 : 0);
+        char_type* first = result.prepare(count);
+        if (is_negative)
+        {
+            *first = '-';
+        }
+        write_digits_backward(u, first + count);
+        result.commit(count);
+        return count;
     }
 
-    return count;
+} // namespace detail
+
+// from_integer
+
+template <typename Integer,typename Result>
+typename std::enable_if<ext_traits::is_integer<Integer>::value,std::size_t>::type
+from_integer(Integer value, Result& result)
+{
+    using unsigned_type = typename ext_traits::make_unsigned<Integer>::type;
+
+    const bool is_negative = value < 0;
+    unsigned_type u = is_negative ? static_cast<unsigned_type>(0 - static_cast<unsigned_type>(value)) : static_cast<unsigned_type>(value);
+
+    return detail::write_integer(u, is_negative, result, std::integral_constant<bool,is_span_sink<Result>::value>());
 }
 
 // integer_to_hex
@@ -238,6 +310,66 @@ void prettify_string(const char *buffer, int length, int k, int min_exp, int max
     }
 }
 
+namespace detail {
+
+    // Room prepared in a span sink, with no bounds checks
+    template <typename CharT>
+    class prepared_span
+    {
+        CharT* p_;
+    public:
+        using value_type = CharT;
+
+        explicit prepared_span(CharT* p)
+            : p_(p)
+        {
+        }
+
+        void push_back(CharT ch)
+        {
+            *p_++ = ch;
+        }
+
+        CharT* position() const
+        {
+            return p_;
+        }
+    };
+
+    template <typename Result>
+    void write_prettified(bool is_negative, const char* buffer, int length, int k, int min_exp, int max_exp, 
+        Result& result, std::false_type)
+    {
+        if (is_negative)
+        {
+            result.push_back('-');
+        }
+        jsoncons::prettify_string(buffer, length, k, min_exp, max_exp, result);
+    }
+
+    // Formats straight into the sink's buffer
+    template <typename Result>
+    void write_prettified(bool is_negative, const char* buffer, int length, int k, int min_exp, int max_exp, 
+        Result& result, std::true_type)
+    {
+        using char_type = typename Result::value_type;
+
+        // Room for the sign, the digits, the zeros before or after them, the point and the exponent
+        const int kk = length + k;
+        const std::size_t room = static_cast<std::size_t>(length + (kk < 0 ? -kk : kk)) + 8;
+
+        char_type* first = result.prepare(room);
+        prepared_span<char_type> span(first);
+        if (is_negative)
+        {
+            span.push_back('-');
+        }
+        jsoncons::prettify_string(buffer, length, k, min_exp, max_exp, span);
+        result.commit(static_cast<std::size_t>(span.position() - first));
+    }
+
+} // namespace detail
+
 template <typename Result>
 void dump_buffer(const char *buffer, std::size_t length, char decimal_point, Result& result)
 {
@@ -364,6 +496,10 @@ bool dtoa_general(double val, char decimal_point, Result& result, std::false_typ
 template <typename Result>
 bool dtoa_general(double v, char decimal_point, Result& result, std::true_type)
 {
+    if (!std::isfinite(v))
+    {
+        return dtoa_general(v, decimal_point, result, std::false_type());
+    }
     if (v == 0)
     {
         result.push_back('0');
@@ -378,21 +514,12 @@ bool dtoa_general(double v, char decimal_point, Result& result, std::true_type)
     char buffer[100];
 
     double u = std::signbit(v) ? -v : v;
-    if (jsoncons::detail::grisu3(u, buffer, &length, &k))
-    {
-        if (std::signbit(v))
-        {
-            result.push_back('-');
-        }
-        // min exp: -4 is consistent with sprintf
-        // max exp: std::numeric_limits<double>::max_digits10
-        jsoncons::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
-        return true;
-    }
-    else
-    {
-        return dtoa_general(v, decimal_point, result, std::false_type());
-    }
+    jsoncons::detail::schubfach_dtoa(u, buffer, &length, &k);
+    // min exp: -4 is consistent with sprintf
+    // max exp: std::numeric_limits<double>::max_digits10
+    detail::write_prettified(std::signbit(v), buffer, length, k, -4, std::numeric_limits<double>::max_digits10, 
+        result, std::integral_constant<bool,is_span_sink<Result>::value>());
+    return true;
 }
 
 template <typename Result>
@@ -435,6 +562,10 @@ bool dtoa_fixed(double val, char decimal_point, Result& result, std::false_type)
 template <typename Result>
 bool dtoa_fixed(double v, char decimal_point, Result& result, std::true_type)
 {
+    if (!std::isfinite(v))
+    {
+        return dtoa_fixed(v, decimal_point, result, std::false_type());
+    }
     if (v == 0)
     {
         result.push_back('0');
@@ -449,19 +580,10 @@ bool dtoa_fixed(double v, char decimal_point, Result& result, std::true_type)
     char buffer[100];
 
     double u = std::signbit(v) ? -v : v;
-    if (jsoncons::detail::grisu3(u, buffer, &length, &k))
-    {
-        if (std::signbit(v))
-        {
-            result.push_back('-');
-        }
-        jsoncons::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
-        return true;
-    }
-    else
-    {
-        return dtoa_fixed(v, decimal_point, result, std::false_type());
-    }
+    jsoncons::detail::schubfach_dtoa(u, buffer, &length, &k);
+    detail::write_prettified(std::signbit(v), buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), 
+        result, std::integral_constant<bool,is_span_sink<Result>::value>());
+    return true;
 }
 
 template <typename Result>
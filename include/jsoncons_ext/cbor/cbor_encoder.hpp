@@ -435,20 +435,17 @@ private:
         else if (length <= 0xffff)
         {
             sink_.push_back(static_cast<uint8_t>(major_type + 0x19));
-            binary::native_to_big(static_cast<uint16_t>(length),
-                                            std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
         }
         else if (length <= 0xffffffff)
         {
             sink_.push_back(static_cast<uint8_t>(major_type + 0x1a));
-            binary::native_to_big(static_cast<uint32_t>(length),
-                                            std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
         }
         else
         {
             sink_.push_back(static_cast<uint8_t>(major_type + 0x1b));
-            binary::native_to_big(static_cast<uint64_t>(length),
-                                            std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint64_t>(length), sink_);
         }
     }
 
@@ -484,36 +481,27 @@ private:
         if (length <= 0x17)
         {
             // fixstr stores a byte array whose length is upto 31 bytes
-            binary::native_to_big(static_cast<uint8_t>(0x40 + length), 
-                                  std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0x40 + length), sink_);
         }
         else if (length <= 0xff)
         {
-            binary::native_to_big(static_cast<uint8_t>(0x58), 
-                                  std::back_inserter(sink_));
-            binary::native_to_big(static_cast<uint8_t>(length), 
-                                  std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0x58), sink_);
+            jsoncons::append_big_endian(static_cast<uint8_t>(length), sink_);
         }
         else if (length <= 0xffff)
         {
-            binary::native_to_big(static_cast<uint8_t>(0x59), 
-                                  std::back_inserter(sink_));
-            binary::native_to_big(static_cast<uint16_t>(length), 
-                                  std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0x59), sink_);
+            jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
         }
         else if (length <= 0xffffffff)
         {
-            binary::native_to_big(static_cast<uint8_t>(0x5a), 
-                                  std::back_inserter(sink_));
-            binary::native_to_big(static_cast<uint32_t>(length), 
-                                  std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0x5a), sink_);
+            jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
         }
         else if (uint64_t(length) <= (std::numeric_limits<std::uint64_t>::max)())
         {
-            binary::native_to_big(static_cast<uint8_t>(0x5b), 
-                                  std::back_inserter(sink_));
-            binary::native_to_big(static_cast<uint64_t>(length), 
-                                  std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0x5b), sink_);
+            jsoncons::append_big_endian(static_cast<uint64_t>(length), sink_);
         }
 
         for (auto c : data)
@@ -1034,15 +1022,13 @@ private:
         float valf = (float)val;
         if ((double)valf == val)
         {
-            binary::native_to_big(static_cast<uint8_t>(0xfa), 
-                                  std::back_inserter(sink_));
-            binary::native_to_big(valf, std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0xfa), sink_);
+            jsoncons::append_big_endian(valf, sink_);
         }
         else
         {
-            binary::native_to_big(static_cast<uint8_t>(0xfb), 
-                                  std::back_inserter(sink_));
-            binary::native_to_big(val, std::back_inserter(sink_));
+            jsoncons::append_big_endian(static_cast<uint8_t>(0xfb), sink_);
+            jsoncons::append_big_endian(val, sink_);
         }
 
         // write double
@@ -159,15 +159,13 @@ namespace msgpack {
             {
                 // map 16
                 sink_.push_back(jsoncons::msgpack::msgpack_type::map16_type);
-                binary::native_to_big(static_cast<uint16_t>(length), 
-                                      std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // map 32
                 sink_.push_back(jsoncons::msgpack::msgpack_type::map32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),
-                                      std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
             }
 
             JSONCONS_VISITOR_RETURN;
@@ -217,13 +215,13 @@ namespace msgpack {
             {
                 // array 16
                 sink_.push_back(jsoncons::msgpack::msgpack_type::array16_type);
-                binary::native_to_big(static_cast<uint16_t>(length),std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // array 32
                 sink_.push_back(jsoncons::msgpack::msgpack_type::array32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
             }
             JSONCONS_VISITOR_RETURN;
         }
@@ -274,14 +272,14 @@ namespace msgpack {
                     // timestamp 32
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext4_type);
                     sink_.push_back(0xff);
-                    binary::native_to_big(static_cast<uint32_t>(data64), std::back_inserter(sink_));
+                    jsoncons::append_big_endian(static_cast<uint32_t>(data64), sink_);
                 }
                 else 
                 {
                     // timestamp 64
                     sink_.push_back(jsoncons::msgpack::msgpack_type::fixext8_type);
                     sink_.push_back(0xff);
-                    binary::native_to_big(static_cast<uint64_t>(data64), std::back_inserter(sink_));
+                    jsoncons::append_big_endian(static_cast<uint64_t>(data64), sink_);
                 }
             }
             else 
@@ -290,8 +288,8 @@ namespace msgpack {
                 sink_.push_back(jsoncons::msgpack::msgpack_type::ext8_type);
                 sink_.push_back(0x0c); // 12
                 sink_.push_back(0xff);
-                binary::native_to_big(static_cast<uint32_t>(nanoseconds), std::back_inserter(sink_));
-                binary::native_to_big(static_cast<uint64_t>(seconds), std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint32_t>(nanoseconds), sink_);
+                jsoncons::append_big_endian(static_cast<uint64_t>(seconds), sink_);
             }
         }
 
@@ -401,13 +399,13 @@ namespace msgpack {
             {
                 // str 16 stores a byte array whose length is upto (2^16)-1 bytes
                 sink_.push_back(jsoncons::msgpack::msgpack_type::str16_type);
-                binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // str 32 stores a byte array whose length is upto (2^32)-1 bytes
                 sink_.push_back(jsoncons::msgpack::msgpack_type::str32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
             }
 
             for (auto c : sv)
@@ -433,13 +431,13 @@ namespace msgpack {
             {
                 // bin 16 stores a byte array whose length is upto (2^16)-1 bytes
                 sink_.push_back(jsoncons::msgpack::msgpack_type::bin16_type);
-                binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
             }
             else if (length <= (std::numeric_limits<uint32_t>::max)())
             {
                 // bin 32 stores a byte array whose length is upto (2^32)-1 bytes
                 sink_.push_back(jsoncons::msgpack::msgpack_type::bin32_type);
-                binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
             }
 
             for (auto c : b)
@@ -489,13 +487,13 @@ namespace msgpack {
                     else if (length <= (std::numeric_limits<uint16_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext16_type);
-                        binary::native_to_big(static_cast<uint16_t>(length), std::back_inserter(sink_));
+                        jsoncons::append_big_endian(static_cast<uint16_t>(length), sink_);
                         sink_.push_back(static_cast<uint8_t>(raw_tag));
                     }
                     else if (length <= (std::numeric_limits<uint32_t>::max)())
                     {
                         sink_.push_back(jsoncons::msgpack::msgpack_type::ext32_type);
-                        binary::native_to_big(static_cast<uint32_t>(length),std::back_inserter(sink_));
+                        jsoncons::append_big_endian(static_cast<uint32_t>(length), sink_);
                         sink_.push_back(static_cast<uint8_t>(raw_tag));
                     }
                     break;
@@ -520,13 +518,13 @@ namespace msgpack {
             {
                 // float 32
                 sink_.push_back(jsoncons::msgpack::msgpack_type::float32_type);
-                binary::native_to_big(valf,std::back_inserter(sink_));
+                jsoncons::append_big_endian(valf, sink_);
             }
             else
             {
                 // float 64
                 sink_.push_back(jsoncons::msgpack::msgpack_type::float64_type);
-                binary::native_to_big(val,std::back_inserter(sink_));
+                jsoncons::append_big_endian(val, sink_);
             }
 
             // write double
@@ -602,19 +600,19 @@ namespace msgpack {
                         {
                             // uint 16 stores a 16-bit big-endian unsigned integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::uint16_type);
-                            binary::native_to_big(static_cast<uint16_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<uint16_t>(val), sink_);
                         }
                         else if (val <= (std::numeric_limits<uint32_t>::max)())
                         {
                             // uint 32 stores a 32-bit big-endian unsigned integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::uint32_type);
-                            binary::native_to_big(static_cast<uint32_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<uint32_t>(val), sink_);
                         }
                         else if (val <= (std::numeric_limits<int64_t>::max)())
                         {
                             // int 64 stores a 64-bit big-endian signed integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::uint64_type);
-                            binary::native_to_big(static_cast<uint64_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<uint64_t>(val), sink_);
                         }
                     }
                     else
@@ -622,31 +620,31 @@ namespace msgpack {
                         if (val >= -32)
                         {
                             // negative fixnum stores 5-bit negative integer
-                            binary::native_to_big(static_cast<int8_t>(val), std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<int8_t>(val), sink_);
                         }
                         else if (val >= (std::numeric_limits<int8_t>::lowest)())
                         {
                             // int 8 stores a 8-bit signed integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::int8_type);
-                            binary::native_to_big(static_cast<int8_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<int8_t>(val), sink_);
                         }
                         else if (val >= (std::numeric_limits<int16_t>::lowest)())
                         {
                             // int 16 stores a 16-bit big-endian signed integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::int16_type);
-                            binary::native_to_big(static_cast<int16_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<int16_t>(val), sink_);
                         }
                         else if (val >= (std::numeric_limits<int32_t>::lowest)())
                         {
                             // int 32 stores a 32-bit big-endian signed integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::int32_type);
-                            binary::native_to_big(static_cast<int32_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<int32_t>(val), sink_);
                         }
                         else if (val >= (std::numeric_limits<int64_t>::lowest)())
                         {
                             // int 64 stores a 64-bit big-endian signed integer
                             sink_.push_back(jsoncons::msgpack::msgpack_type::int64_type);
-                            binary::native_to_big(static_cast<int64_t>(val),std::back_inserter(sink_));
+                            jsoncons::append_big_endian(static_cast<int64_t>(val), sink_);
                         }
                     }
                 }
@@ -721,19 +719,19 @@ namespace msgpack {
                     {
                         // uint 16 stores a 16-bit big-endian unsigned integer
                         sink_.push_back(jsoncons::msgpack::msgpack_type::uint16_type);
-                        binary::native_to_big(static_cast<uint16_t>(val),std::back_inserter(sink_));
+                        jsoncons::append_big_endian(static_cast<uint16_t>(val), sink_);
                     }
                     else if (val <= (std::numeric_limits<uint32_t>::max)())
                     {
                         // uint 32 stores a 32-bit big-endian unsigned integer
                         sink_.push_back(jsoncons::msgpack::msgpack_type::uint32_type);
-                        binary::native_to_big(static_cast<uint32_t>(val),std::back_inserter(sink_));
+                        jsoncons::append_big_endian(static_cast<uint32_t>(val), sink_);
                     }
                     else if (val <= (std::numeric_limits<uint64_t>::max)())
                     {
                         // uint 64 stores a 64-bit big-endian unsigned integer
                         sink_.push_back(jsoncons::msgpack::msgpack_type::uint64_type);
-                        binary::native_to_big(static_cast<uint64_t>(val),std::back_inserter(sink_));
+                        jsoncons::append_big_endian(static_cast<uint64_t>(val), sink_);
                     }
                     break;
                 }
@@ -0,0 +1,123 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <utility>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string input = R"(
+{
+    "short" : "abc",
+    "String too long for short string" : "Another string too long for short string",
+    "numbers" : [1, -2, 3.5, 18446744073709551615],
+    "nested" : [{"a" : [true, false, null]}, {"b" : {"c" : "Yet another string too long for short string"}}]
+}
+    )";
+
+} // namespace
+
+TEST_CASE("json_arena tests")
+{
+    json_arena arena(64);
+
+    void* p1 = arena.allocate(10, 1);
+    void* p2 = arena.allocate(8, 8);
+    CHECK(reinterpret_cast<std::uintptr_t>(p2) % 8 == 0);
+    CHECK(static_cast<char*>(p2) >= static_cast<char*>(p1) + 10);
+
+    // The most recent allocation is given back
+    arena.deallocate(p2, 8);
+    CHECK(arena.allocate(8, 8) == p2);
+
+    std::size_t reserved = arena.bytes_reserved();
+    void* big = arena.allocate(1000, 16);
+    CHECK(reinterpret_cast<std::uintptr_t>(big) % 16 == 0);
+    CHECK(arena.bytes_reserved() >= reserved + 1000);
+
+    arena.release();
+    CHECK(arena.bytes_reserved() == 0);
+}
+
+TEST_CASE("arena_json tests")
+{
+    json_arena arena;
+    arena_json::allocator_type alloc(arena);
+
+    SECTION("parse")
+    {
+        arena_json j = arena_json::parse(make_alloc_set(alloc), input);
+        CHECK(arena.bytes_reserved() > 0);
+        CHECK(j.get_allocator() == alloc);
+        CHECK(j.at("numbers").get_allocator() == alloc);
+        CHECK(j.at("String too long for short string").get_allocator() == alloc);
+
+        json expected = json::parse(input);
+        CHECK(j.size() == expected.size());
+        CHECK(j.to_string() == expected.to_string());
+    }
+
+    SECTION("parse with temp_allocator_arg")
+    {
+        json_arena temp_arena;
+        arena_json j = arena_json::parse(make_alloc_set(alloc, arena_json::allocator_type(temp_arena)), input);
+        CHECK(j.to_string() == json::parse(input).to_string());
+        CHECK(j["nested"][1]["b"]["c"].as<std::string>() == "Yet another string too long for short string");
+    }
+
+    SECTION("modify")
+    {
+        arena_ojson j(json_object_arg, alloc);
+        j.try_emplace("Key too long for short string", "Value too long for short string");
+        j.insert_or_assign("array", arena_ojson(json_array_arg, alloc));
+        for (int i = 0; i < 100; ++i)
+        {
+            j["array"].emplace_back(i);
+            j["array"].emplace_back("String too long for short string");
+        }
+        j.erase("Key too long for short string");
+        CHECK(j.size() == 1);
+        CHECK(j["array"].size() == 200);
+        CHECK(j["array"][198].as<int>() == 99);
+        CHECK(j["array"][199].as<std::string>() == "String too long for short string");
+    }
+
+    SECTION("copy into another arena")
+    {
+        arena_json j = arena_json::parse(make_alloc_set(alloc), input);
+
+        json_arena other_arena;
+        arena_json::allocator_type other_alloc(other_arena);
+        arena_json copy(j, other_alloc);
+        CHECK(copy == j);
+        CHECK(copy.get_allocator() == other_alloc);
+        CHECK(copy["nested"].get_allocator() == other_alloc);
+
+        arena_json moved(std::move(copy), alloc);
+        CHECK(moved == j);
+        CHECK(moved.get_allocator() == alloc);
+    }
+}
+
+TEST_CASE("arena_json destruction")
+{
+    json_arena arena;
+    arena_json::allocator_type alloc(arena);
+    {
+        arena_json j = arena_json::parse(make_alloc_set(alloc), input);
+        CHECK(j.size() == 4);
+    }
+    // Destroying the document gives nothing back, the arena reclaims everything at once
+    std::size_t reserved = arena.bytes_reserved();
+    CHECK(reserved > 0);
+    arena.release();
+    CHECK(arena.bytes_reserved() == 0);
+
+    CHECK(is_monotonic_allocator<arena_allocator<char>>::value);
+    CHECK(is_monotonic_allocator<arena_json::allocator_type>::value);
+    CHECK_FALSE(is_monotonic_allocator<std::allocator<char>>::value);
+}
@@ -0,0 +1,228 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    using cow_json = basic_json<char,copy_on_write_policy<sorted_policy>>;
+    using cow_ojson = basic_json<char,copy_on_write_policy<ordered_policy>>;
+
+    template <typename Json>
+    bool is_shared(const Json& j)
+    {
+        switch (j.storage_kind())
+        {
+            case json_storage_kind::array:
+                return j.template cast<typename Json::array_storage>().value().is_shared();
+            case json_storage_kind::object:
+                return j.template cast<typename Json::object_storage>().value().is_shared();
+            default:
+                return false;
+        }
+    }
+
+    const std::string input = R"(
+{
+    "books": [
+        {"title": "Pulp", "price": 22.72, "tags": ["crime"]},
+        {"title": "Sword of Honour", "price": 12.5, "tags": ["war", "satire"]}
+    ],
+    "owner": {"name": "John", "address": {"city": "Toronto"}},
+    "count": 2
+}
+    )";
+
+} // namespace
+
+TEST_CASE("cow_json copy tests")
+{
+    const cow_json doc = cow_json::parse(input);
+
+    SECTION("copies share")
+    {
+        const cow_json copy(doc);
+        CHECK(is_shared(doc));
+        CHECK(is_shared(copy));
+        CHECK(&copy.at("owner") == &doc.at("owner"));
+        CHECK(copy == doc);
+
+        cow_json other;
+        other = doc;
+        CHECK(&static_cast<const cow_json&>(other).at("books") == &doc.at("books"));
+    }
+
+    SECTION("modification copies the path")
+    {
+        cow_json copy(doc);
+        copy["owner"]["address"]["city"] = "Montreal";
+
+        CHECK(doc.at("owner").at("address").at("city").as<std::string>() == "Toronto");
+        CHECK(copy.at("owner").at("address").at("city").as<std::string>() == "Montreal");
+        CHECK_FALSE(is_shared(doc.at("owner")));
+
+        // the other members are still shared
+        const cow_json& c = copy;
+        CHECK(&c.at("books").at(0) == &doc.at("books").at(0));
+        CHECK(is_shared(doc.at("books")));
+        CHECK(c.at("books") == doc.at("books"));
+    }
+
+    SECTION("array modification")
+    {
+        cow_json copy(doc);
+        copy["books"][1]["tags"].push_back("classic");
+        copy["books"].erase(copy["books"].array_range().begin());
+
+        CHECK(doc.at("books").size() == 2);
+        CHECK(doc.at("books").at(1).at("tags").size() == 2);
+        CHECK(copy.at("books").size() == 1);
+        CHECK(copy.at("books").at(0).at("tags").size() == 3);
+        CHECK(&static_cast<const cow_json&>(copy).at("owner").at("name") == &doc.at("owner").at("name"));
+    }
+
+    SECTION("object modification")
+    {
+        cow_json copy(doc);
+        copy.erase("count");
+        copy.try_emplace("year", 2026);
+        copy.insert_or_assign("owner", "Jane");
+
+        CHECK(doc.size() == 3);
+        CHECK(doc.contains("count"));
+        CHECK(doc.at("owner").is_object());
+        CHECK(copy.size() == 3);
+        CHECK(copy.at("owner").as<std::string>() == "Jane");
+        CHECK(copy.at("year").as<int>() == 2026);
+    }
+
+    SECTION("erase with a const iterator into a shared object")
+    {
+        cow_json copy(doc);
+        const cow_json& c = copy;
+        auto it = c.find("count");
+        REQUIRE((it != c.object_range().end()));
+        copy.erase(it);
+
+        CHECK(copy.size() == 2);
+        CHECK_FALSE(copy.contains("count"));
+        CHECK(doc.size() == 3);
+    }
+
+    SECTION("clear and erase of a missing key")
+    {
+        cow_json copy(doc);
+        CHECK(copy.erase("nothing") == 0);
+        CHECK(is_shared(copy));
+
+        copy["books"].clear();
+        CHECK(copy.at("books").empty());
+        CHECK(doc.at("books").size() == 2);
+    }
+}
+
+TEST_CASE("cow_json references tests")
+{
+    cow_json doc = cow_json::parse(input);
+
+    SECTION("a copy does not see writes through an earlier reference")
+    {
+        cow_json& count = doc["count"];
+        cow_json copy(doc);
+        count = 3;
+
+        CHECK(doc["count"].as<int>() == 3);
+        CHECK(copy["count"].as<int>() == 2);
+    }
+
+    SECTION("a copy does not see writes through an earlier iterator")
+    {
+        auto it = doc["books"].array_range().begin();
+        cow_json copy(doc);
+        *it = "none";
+
+        CHECK(doc["books"][0].as<std::string>() == "none");
+        CHECK(copy["books"][0].is_object());
+    }
+}
+
+TEST_CASE("cow_ojson tests")
+{
+    const cow_ojson doc = cow_ojson::parse(input);
+
+    cow_ojson copy(doc);
+    copy["owner"].merge_or_update(cow_ojson::parse(R"({"name": "Jane", "phone": "555"})"));
+    copy.try_emplace(copy.object_range().end(), "id", 1);
+
+    CHECK(doc.at("owner").at("name").as<std::string>() == "John");
+    CHECK(copy.at("owner").at("name").as<std::string>() == "Jane");
+    CHECK(copy.at("owner").at("phone").as<std::string>() == "555");
+    CHECK(copy.at("id").as<int>() == 1);
+    CHECK_FALSE(doc.contains("id"));
+    CHECK(doc.object_range().begin()->key() == "books");
+    CHECK(copy.to_string() != doc.to_string());
+
+    cow_ojson restored(copy);
+    restored.erase("id");
+    restored["owner"] = doc["owner"];
+    CHECK(restored == doc);
+}
+
+TEST_CASE("cow_json deep nesting tests")
+{
+    cow_json j(json_array_arg);
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        cow_json outer(json_array_arg);
+        outer.push_back(std::move(j));
+        j = std::move(outer);
+    }
+
+    cow_json copy(j);
+    CHECK(is_shared(j));
+    copy.push_back(1);
+    CHECK(j.size() == 1);
+    CHECK(copy.size() == 2);
+    CHECK(is_shared(static_cast<const cow_json&>(j)[0]));
+
+    // destroying either only releases the shared nested arrays
+    j = cow_json();
+    CHECK(copy.size() == 2);
+    CHECK_FALSE(is_shared(static_cast<const cow_json&>(copy)[0]));
+}
+
+TEST_CASE("cow_json concurrent copy tests")
+{
+    const cow_json doc = cow_json::parse(input);
+
+    std::vector<std::string> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); ++t)
+    {
+        threads.emplace_back([&doc, &results, t]()
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                cow_json copy(doc);
+                copy["owner"]["address"]["city"] = std::to_string(t);
+                copy["books"][0]["tags"].push_back(i);
+                results[t] = copy["owner"]["address"]["city"].as<std::string>();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (std::size_t t = 0; t < results.size(); ++t)
+    {
+        CHECK(results[t] == std::to_string(t));
+    }
+    CHECK(doc == cow_json::parse(input));
+}
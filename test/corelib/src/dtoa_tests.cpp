@@ -1,8 +1,11 @@
 // Copyright 2013-2026 Daniel Parker
 // Distributed under Boost license
 
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <string>
 
 #include <catch/catch.hpp>
 
@@ -58,7 +61,14 @@ static void check_dtoa(double x, const std::vector<std::string>& expected)
     check_safe_dtoa(x,expected);
 }
 
-TEST_CASE("test grisu3")
+static void check_shortest(double x, const std::string& expected)
+{
+    std::string s;
+    REQUIRE(jsoncons::dtoa_general(x, '.', s));
+    CHECK(s == expected);
+}
+
+TEST_CASE("dtoa shortest representation tests")
 {
     check_dtoa(1.0e100, {"1e+100"});
     check_dtoa(1.0e-100, {"1e-100"});
@@ -100,3 +110,57 @@ TEST_CASE("test grisu3")
     check_dtoa(0.000071, {"7.1e-05"}); 
 }
 
+
+TEST_CASE("dtoa_general shortest round trip")
+{
+    SECTION("values that Grisu3 could not handle")
+    {
+        // The snprintf path gives 9640980.7548828125 and 137.01828002929688 here
+        check_shortest(9640980.754882812, "9640980.754882812");
+        check_shortest(137.01828002929688, "137.01828002929688");
+        check_shortest(26913.355102539062, "26913.355102539062");
+        check_shortest(2165632.9975585938, "2165632.9975585938");
+    }
+    SECTION("boundaries")
+    {
+        check_shortest(5e-324, "5e-324");
+        check_shortest(-5e-324, "-5e-324");
+        check_shortest(2.2250738585072014e-308, "2.2250738585072014e-308");
+        check_shortest(2.225073858507201e-308, "2.225073858507201e-308");
+        check_shortest(1.7976931348623157e308, "1.7976931348623157e+308");
+        check_shortest(9007199254740992.0, "9007199254740992.0");
+        check_shortest(1e23, "1e+23");
+        check_shortest(5e22, "5e+22");
+        check_shortest(0.3, "0.3");
+        check_shortest(2.0e-3, "0.002");
+    }
+    SECTION("random values round trip")
+    {
+        uint64_t state = 0x853c49e6748fea9b;
+        for (int i = 0; i < 100000; ++i)
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            double x;
+            uint64_t bits = state & 0x7fefffffffffffffULL;
+            std::memcpy(&x, &bits, sizeof(double));
+
+            std::string s;
+            REQUIRE(jsoncons::dtoa_general(x, '.', s));
+            double y = 0;
+            auto res = jsoncons::decstr_to_double(s.data(), s.size(), y);
+            REQUIRE(res.ec == std::errc());
+            CHECK(y == x);
+        }
+    }
+}
+
+TEST_CASE("dtoa_fixed shortest round trip")
+{
+    std::string s;
+    REQUIRE(jsoncons::dtoa_fixed(9640980.754882812, '.', s));
+    CHECK(s == "9640980.754882812");
+
+    s.clear();
+    REQUIRE(jsoncons::dtoa_fixed(1e-7, '.', s));
+    CHECK(s == "0.0000001");
+}
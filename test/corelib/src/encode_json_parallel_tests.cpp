@@ -0,0 +1,166 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/encode_json_parallel.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <typename Json>
+    Json make_record(std::size_t i)
+    {
+        Json record(json_object_arg);
+        record.try_emplace("id", i);
+        record.try_emplace("name", "name/" + std::to_string(i) + " \"quoted\" \xC3\xA9");
+        record.try_emplace("score", static_cast<double>(i) / 7.0);
+        record.try_emplace("flags", Json(json_array_arg, {true, false, Json::null()}));
+        record.try_emplace("negative", -static_cast<int64_t>(i));
+        return record;
+    }
+
+    template <typename Json>
+    Json make_document(std::size_t n)
+    {
+        Json doc(json_array_arg);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            doc.push_back(make_record<Json>(i));
+        }
+        return doc;
+    }
+
+    const parallel_encode_options four_threads = parallel_encode_options().max_threads(4).min_container_size(16);
+
+} // namespace
+
+TEST_CASE("encode_json_parallel compact output")
+{
+    SECTION("large array")
+    {
+        json doc = make_document<json>(1000);
+
+        std::string expected;
+        encode_json(doc, expected);
+
+        std::string s;
+        encode_json_parallel(doc, s, json_options(), indenting::no_indent, four_threads);
+        CHECK(s == expected);
+    }
+    SECTION("large object with large nested containers")
+    {
+        ojson doc(json_object_arg);
+        doc.try_emplace("before", 1);
+        doc.try_emplace("records", make_document<ojson>(500));
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            doc.try_emplace("key" + std::to_string(i), make_record<ojson>(i));
+        }
+        ojson lookup(json_object_arg);
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            lookup.try_emplace("k/" + std::to_string(i), i);
+        }
+        doc.try_emplace("lookup", std::move(lookup));
+        doc.try_emplace("after", "end");
+
+        std::string expected;
+        encode_json(doc, expected);
+
+        std::string s;
+        encode_json_parallel(doc, s, json_options(), indenting::no_indent, four_threads);
+        CHECK(s == expected);
+    }
+    SECTION("encode options")
+    {
+        json doc = make_document<json>(200);
+        auto options = json_options().escape_all_non_ascii(true).escape_solidus(true).float_format(float_chars_format::fixed);
+
+        std::string expected;
+        encode_json(doc, expected, options);
+
+        std::string s;
+        encode_json_parallel(doc, s, options, indenting::no_indent, four_threads);
+        CHECK(s == expected);
+    }
+    SECTION("to stream")
+    {
+        json doc = make_document<json>(300);
+
+        std::ostringstream expected;
+        encode_json(doc, expected);
+
+        std::ostringstream os;
+        encode_json_parallel(doc, os, json_options(), indenting::no_indent, four_threads);
+        CHECK(os.str() == expected.str());
+    }
+    SECTION("small documents are encoded sequentially")
+    {
+        json doc = json::parse(R"({"a":[1,2,3],"b":"c"})");
+        std::string s;
+        encode_json_parallel(doc, s, json_options(), indenting::no_indent, four_threads);
+        CHECK(s == R"({"a":[1,2,3],"b":"c"})");
+
+        s.clear();
+        encode_json_parallel(json(1.5), s);
+        CHECK(s == "1.5");
+    }
+}
+
+TEST_CASE("encode_json_parallel indented output")
+{
+    SECTION("array of objects")
+    {
+        json doc = make_document<json>(200);
+
+        std::string expected;
+        encode_json(doc, expected, indenting::indent);
+
+        std::string s;
+        encode_json_parallel(doc, s, json_options(), indenting::indent, four_threads);
+        CHECK(s == expected);
+    }
+    SECTION("object of arrays")
+    {
+        json doc(json_object_arg);
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            doc.try_emplace("key" + std::to_string(i), json(json_array_arg, {make_record<json>(i), make_record<json>(i + 1)}));
+        }
+
+        std::string expected;
+        encode_json(doc, expected, indenting::indent);
+
+        std::string s;
+        encode_json_parallel(doc, s, json_options(), indenting::indent, four_threads);
+        CHECK(s == expected);
+    }
+}
+
+TEST_CASE("encode_json_parallel errors")
+{
+    json doc(json_array_arg);
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        doc.push_back(json(json_array_arg, {json(json_array_arg, {i})}));
+    }
+
+    auto options = json_options().max_nesting_depth(2);
+
+    std::string s;
+    auto r = try_encode_json(doc, s, options, indenting::no_indent);
+    REQUIRE_FALSE(r);
+
+    std::string s2;
+    auto r2 = try_encode_json_parallel(doc, s2, options, indenting::no_indent, four_threads);
+    REQUIRE_FALSE(r2);
+    CHECK(r2.error() == r.error());
+    CHECK(s2.empty());
+
+    CHECK_THROWS_AS(encode_json_parallel(doc, s2, options, indenting::no_indent, four_threads), ser_error);
+}
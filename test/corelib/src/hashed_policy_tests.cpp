@@ -0,0 +1,185 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <map>
+#include <random>
+#include <string>
+
+using namespace jsoncons;
+
+using hashed_json = basic_json<char,hashed_policy>;
+using unordered_hashed_json = basic_json<char,unordered_hashed_policy>;
+
+namespace {
+
+    template <typename Json>
+    void check_against_model(const Json& j, const std::map<std::string,int>& model)
+    {
+        REQUIRE(j.size() == model.size());
+        for (const auto& item : model)
+        {
+            REQUIRE(j.contains(item.first));
+            CHECK(j.at(item.first).template as<int>() == item.second);
+        }
+        for (const auto& member : j.object_range())
+        {
+            CHECK(model.count(std::string(member.key())) == 1);
+        }
+    }
+
+    template <typename Json>
+    void random_operations(std::size_t num_keys)
+    {
+        std::mt19937 gen(static_cast<unsigned>(num_keys));
+        std::uniform_int_distribution<std::size_t> key_dist(0, num_keys - 1);
+        std::uniform_int_distribution<int> op_dist(0, 3);
+
+        Json j(json_object_arg);
+        std::map<std::string,int> model;
+        for (int i = 0; i < static_cast<int>(num_keys)*4; ++i)
+        {
+            std::string key = "key" + std::to_string(key_dist(gen));
+            switch (op_dist(gen))
+            {
+                case 0:
+                    j.insert_or_assign(key, i);
+                    model[key] = i;
+                    break;
+                case 1:
+                    j.try_emplace(key, i);
+                    model.emplace(key, i);
+                    break;
+                case 2:
+                    j.erase(key);
+                    model.erase(key);
+                    break;
+                default:
+                    CHECK(j.contains(key) == (model.count(key) == 1));
+                    break;
+            }
+        }
+        check_against_model(j, model);
+    }
+
+} // namespace
+
+TEMPLATE_TEST_CASE("hashed_policy tests", "", hashed_json, unordered_hashed_json)
+{
+    using Json = TestType;
+
+    SECTION("random operations")
+    {
+        random_operations<Json>(5);
+        random_operations<Json>(100);
+        random_operations<Json>(3000);
+    }
+
+    SECTION("parse and dump")
+    {
+        std::string input = R"({"b":1,"a":[1,2,{"y":true,"x":null}],"c":{"e":"f","d":"g"},"b":2})";
+        Json j = Json::parse(input);
+        CHECK(j.size() == 3);
+        CHECK(j["b"].template as<int>() == 1);
+        CHECK(Json::parse(j.to_string()) == j);
+        CHECK(json::parse(j.to_string()) == json::parse(input));
+    }
+
+    SECTION("large object")
+    {
+        std::string input = "{";
+        for (int i = 0; i < 1000; ++i)
+        {
+            if (i > 0)
+            {
+                input.push_back(',');
+            }
+            input += "\"" + std::to_string(i*7919 % 1000) + "\":" + std::to_string(i);
+        }
+        input.push_back('}');
+
+        Json j = Json::parse(input);
+        CHECK(j.size() == 1000);
+        CHECK(j.at("0").template as<int>() == 0);
+        CHECK(j.at("919").template as<int>() == 1);
+        CHECK_FALSE(j.contains("1000"));
+        CHECK(json::parse(j.to_string()) == json::parse(input));
+    }
+
+    SECTION("erase while iterating")
+    {
+        Json j(json_object_arg);
+        for (int i = 0; i < 50; ++i)
+        {
+            j.try_emplace(std::to_string(i), i);
+        }
+        auto range = j.object_range();
+        for (auto it = range.begin(); it != j.object_range().end();)
+        {
+            if (it->value().template as<int>() % 2 == 0)
+            {
+                it = j.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        CHECK(j.size() == 25);
+        for (int i = 0; i < 50; ++i)
+        {
+            CHECK(j.contains(std::to_string(i)) == (i % 2 == 1));
+        }
+    }
+
+    SECTION("comparison")
+    {
+        Json a = Json::parse(R"({"a":1,"b":2,"c":3})");
+        Json b = Json::parse(R"({"c":3,"b":2,"a":1})");
+        Json c = Json::parse(R"({"c":3,"b":2,"a":2})");
+        CHECK(a == b);
+        CHECK_FALSE(a < b);
+        CHECK_FALSE(b < a);
+        CHECK(a != c);
+        CHECK(((a < c) != (c < a)));
+    }
+
+    SECTION("copy and merge")
+    {
+        Json a = Json::parse(R"({"a":1,"b":2,"c":3,"d":4,"e":5,"f":6,"g":7,"h":8,"i":9})");
+        Json b = Json::parse(R"({"a":10,"z":26})");
+        Json copy(a);
+        CHECK(copy == a);
+
+        copy.merge(b);
+        CHECK(copy.size() == 10);
+        CHECK(copy["a"].template as<int>() == 1);
+        copy.merge_or_update(b);
+        CHECK(copy["a"].template as<int>() == 10);
+        CHECK(copy["z"].template as<int>() == 26);
+    }
+}
+
+TEST_CASE("hashed_policy insertion order")
+{
+    hashed_json j(json_object_arg);
+    for (int i = 20; i > 0; --i)
+    {
+        j.try_emplace(std::to_string(i), i);
+    }
+    j.erase("10");
+    j.insert_or_assign("15", 0);
+
+    int expected = 20;
+    for (const auto& member : j.object_range())
+    {
+        if (expected == 10)
+        {
+            --expected;
+        }
+        CHECK(member.key() == std::to_string(expected));
+        --expected;
+    }
+    CHECK(j.to_string().substr(0, 16) == R"({"20":20,"19":19)");
+}
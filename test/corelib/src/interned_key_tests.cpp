@@ -0,0 +1,131 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <utility>
+
+using namespace jsoncons;
+
+using interned_json = basic_json<char,interned_keys_policy<sorted_policy>>;
+using interned_ojson = basic_json<char,interned_keys_policy<ordered_policy>>;
+using interned_hashed_json = basic_json<char,interned_keys_policy<hashed_policy>>;
+
+namespace {
+
+    const std::string records = R"(
+[
+    {"id" : 1, "status" : "active", "a key too long for short string optimization" : true},
+    {"status" : "inactive", "id" : 2, "a key too long for short string optimization" : false},
+    {"id" : 3, "status" : "active", "a key too long for short string optimization" : null, "id" : 4}
+]
+    )";
+
+} // namespace
+
+TEST_CASE("interned_key tests")
+{
+    interned_key empty;
+    CHECK(empty.empty());
+    CHECK(empty.size() == 0);
+    CHECK(empty.c_str()[0] == 0);
+
+    interned_key a("status");
+    interned_key b(a);
+    CHECK(a == b);
+    CHECK(a.data() == b.data());
+    CHECK(a == "status");
+    CHECK(std::string(a.c_str()) == "status");
+
+    interned_key c(std::string("status"));
+    CHECK(c == a);
+    CHECK(c.data() != a.data());
+    CHECK(a < interned_key("z"));
+    CHECK(interned_key("id") < a);
+    CHECK(a.compare(string_view("statut")) < 0);
+
+    interned_key d(std::move(b));
+    CHECK(d.data() == a.data());
+    CHECK(b.empty());
+    d = interned_key("other");
+    CHECK(d == "other");
+    CHECK(a == "status");
+
+    const char* text = "statuses";
+    interned_key e(text, text + 6);
+    CHECK(e == a);
+    std::string s("status");
+    interned_key f(s.begin(), s.end());
+    CHECK(f == a);
+}
+
+TEMPLATE_TEST_CASE("interned_keys_policy tests", "", interned_json, interned_ojson, interned_hashed_json)
+{
+    using Json = TestType;
+
+    SECTION("keys of records share their text")
+    {
+        Json j = Json::parse(records);
+        REQUIRE(j.size() == 3);
+        CHECK(j[2].size() == 3);
+        CHECK(j[2]["id"].template as<int>() == 3);
+
+        auto key_data = [&](std::size_t i, const std::string& name) -> const char*
+        {
+            for (const auto& member : j[i].object_range())
+            {
+                if (member.key() == name)
+                {
+                    return member.key().data();
+                }
+            }
+            return nullptr;
+        };
+        for (const char* name : {"id", "status", "a key too long for short string optimization"})
+        {
+            REQUIRE(key_data(0, name) != nullptr);
+            CHECK(key_data(0, name) == key_data(1, name));
+            CHECK(key_data(0, name) == key_data(2, name));
+        }
+
+        CHECK(json::parse(j.to_string()) == json::parse(records));
+    }
+
+    SECTION("modify")
+    {
+        Json j = Json::parse(records);
+        Json& record = j[1];
+        record.insert_or_assign("status", "active");
+        record.try_emplace("name", "Fred");
+        CHECK(record.erase("id") == 1);
+        CHECK(record.size() == 3);
+        CHECK(record["status"].template as<std::string>() == "active");
+        CHECK(record.contains("name"));
+        CHECK_FALSE(record.contains("id"));
+
+        Json copy(j);
+        CHECK(copy == j);
+        copy[0].merge_or_update(j[1]);
+        CHECK(copy[0]["name"].template as<std::string>() == "Fred");
+        CHECK(copy[0]["id"].template as<int>() == 1);
+    }
+}
+
+TEST_CASE("interned_keys_policy with arena")
+{
+    using arena_interned_json = basic_json<char,interned_keys_policy<sorted_policy>,arena_json::allocator_type>;
+
+    json_arena arena;
+    arena_interned_json::allocator_type alloc(arena);
+
+    arena_interned_json j = arena_interned_json::parse(make_alloc_set(alloc), records);
+    REQUIRE(j.size() == 3);
+    CHECK(j[0].object_range().begin()->key().data() == j[1].object_range().begin()->key().data());
+    CHECK(j.to_string() == interned_json::parse(records).to_string());
+
+    json_arena other_arena;
+    arena_interned_json copy(j, arena_interned_json::allocator_type(other_arena));
+    CHECK(copy == j);
+    CHECK(copy[0].object_range().begin()->key().data() != j[0].object_range().begin()->key().data());
+}
@@ -0,0 +1,107 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_compact.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <typename Json>
+    Json make_mutated_document()
+    {
+        Json doc(json_object_arg);
+        for (int i = 0; i < 50; ++i)
+        {
+            Json item(json_object_arg);
+            item.insert_or_assign("id", i);
+            item.insert_or_assign("name", std::string("a name that is too long to be stored in place ") + std::to_string(i));
+            item.insert_or_assign("a key that is longer than the small string buffer", 1.5);
+            Json values(json_array_arg);
+            for (int k = 0; k < i % 7; ++k)
+            {
+                values.push_back(k);
+            }
+            item.insert_or_assign("values", std::move(values));
+            doc.insert_or_assign("item" + std::to_string(i), std::move(item));
+        }
+        doc.insert_or_assign("empty", Json(json_object_arg));
+        doc.insert_or_assign("nothing", Json::null());
+        return doc;
+    }
+
+} // namespace
+
+TEST_CASE("compact_copy tests")
+{
+    SECTION("json")
+    {
+        json doc = make_mutated_document<json>();
+
+        json_arena arena(64);
+        arena_json compact = compact_copy(doc, arena);
+
+        CHECK(compact.template as<std::string>() == doc.template as<std::string>());
+        CHECK(arena.bytes_reserved() == detail::compact_size<arena_json>(doc));
+        CHECK(compact["item6"]["values"].capacity() == 6);
+        CHECK(compact["item0"]["values"].capacity() == 0);
+    }
+
+    SECTION("ojson")
+    {
+        ojson doc = make_mutated_document<ojson>();
+        doc["item3"].erase("id");
+
+        json_arena arena(64);
+        arena_ojson compact = compact_copy(doc, arena);
+
+        CHECK(compact.template as<std::string>() == doc.template as<std::string>());
+        CHECK(compact["item6"].capacity() == compact["item6"].size());
+    }
+
+    SECTION("scalars keep their tags")
+    {
+        std::vector<uint8_t> bytes = {'H','e','l','l','o'};
+        json doc(json_array_arg);
+        doc.emplace_back(byte_string_arg, bytes, semantic_tag::base64);
+        doc.emplace_back(byte_string_arg, bytes, 42);
+        doc.emplace_back(half_arg, 0x3c00);
+        doc.emplace_back("2026-10-16T00:00:00Z", semantic_tag::datetime);
+        doc.emplace_back(int64_t(-7), semantic_tag::epoch_second);
+        doc.emplace_back(true);
+        doc.emplace_back("123456789012345678901234567890", semantic_tag::bigint);
+
+        json_arena arena;
+        arena_json compact = compact_copy(doc, arena);
+
+        REQUIRE(compact.size() == doc.size());
+        CHECK(compact[0].tag() == semantic_tag::base64);
+        CHECK(compact[0].as_byte_string_view() == doc[0].as_byte_string_view());
+        CHECK(compact[1].tag() == semantic_tag::ext);
+        CHECK(compact[1].ext_tag() == 42);
+        CHECK(compact[2].is_half());
+        CHECK(compact[2].as<double>() == 1.0);
+        CHECK(compact[3].tag() == semantic_tag::datetime);
+        CHECK(compact[4].tag() == semantic_tag::epoch_second);
+        CHECK(compact[4].as<int64_t>() == -7);
+        CHECK(compact[5].as<bool>());
+        CHECK(compact[6].tag() == semantic_tag::bigint);
+    }
+
+    SECTION("references are followed")
+    {
+        json target = json::parse(R"({"a":[1,2,3]})");
+        json doc(json_array_arg);
+        doc.emplace_back(json_const_pointer_arg, &target);
+
+        json_arena arena;
+        arena_json compact = compact_copy(doc, arena);
+        CHECK(compact[0]["a"].size() == 3);
+        CHECK(compact[0].storage_kind() == json_storage_kind::object);
+    }
+}
@@ -679,3 +679,53 @@ TEMPLATE_TEST_CASE("json_cursor reset test", "",
         CHECK(cursor.done());
     }
 }
+
+TEST_CASE("json_cursor in place tests")
+{
+    SECTION("string views remain valid")
+    {
+        std::string buffer = R"({"first\tname":"Tom","address":["1 \"Main\" St","Café 😀"],"age":42})";
+        json_string_cursor cursor(in_place_arg, &buffer[0], buffer.size());
+
+        std::vector<jsoncons::string_view> views;
+        for (; !cursor.done(); cursor.next())
+        {
+            const auto& event = cursor.current();
+            if (event.event_type() == staj_events::key || event.event_type() == staj_events::string_value)
+            {
+                views.push_back(event.get<jsoncons::string_view>());
+            }
+        }
+
+        std::vector<std::string> expected = {"first\tname", "Tom", "address", "1 \"Main\" St", "Caf\xC3\xA9 \xF0\x9F\x98\x80", "age"};
+        REQUIRE(views.size() == expected.size());
+        for (std::size_t i = 0; i < views.size(); ++i)
+        {
+            CHECK(std::string(views[i]) == expected[i]);
+            CHECK(views[i].data() >= buffer.data());
+            CHECK(views[i].data() + views[i].size() <= buffer.data() + buffer.size());
+        }
+    }
+
+    SECTION("wide characters")
+    {
+        std::wstring buffer = LR"(["a\"b", "é"])";
+        wjson_string_cursor cursor(in_place_arg, &buffer[0], buffer.size());
+        cursor.next();
+        CHECK(cursor.current().get<std::wstring>() == L"a\"b");
+        cursor.next();
+        CHECK(cursor.current().get<std::wstring>() == L"é");
+    }
+
+    SECTION("errors")
+    {
+        std::string buffer = R"(["a\x"])";
+        std::error_code ec;
+        json_string_cursor cursor(in_place_arg, &buffer[0], buffer.size(), json_options{}, ec);
+        if (!ec)
+        {
+            cursor.next(ec);
+        }
+        CHECK(ec == json_errc::illegal_escaped_character);
+    }
+}
@@ -116,3 +116,57 @@ TEMPLATE_TEST_CASE("test_json_encoder_reset", "",
     f.encoder.flush();
     CHECK(f.string2() == R"(["foo",42])");
 }
+
+TEST_CASE("escape_string tests")
+{
+    auto escape = [](const std::string& s, bool escape_all_non_ascii, bool escape_solidus) -> std::string
+    {
+        std::string result;
+        string_sink<std::string> sink(result);
+        std::size_t count = jsoncons::detail::escape_string(s.data(), s.size(), escape_all_non_ascii, escape_solidus, sink);
+        CHECK(count == result.size());
+        return result;
+    };
+    auto escape_each = [](const std::string& s, bool escape_all_non_ascii, bool escape_solidus) -> std::string
+    {
+        std::string result;
+        string_sink<std::string> sink(result);
+        jsoncons::detail::escape_string(std::false_type(), s.data(), s.size(), escape_all_non_ascii, escape_solidus, sink);
+        return result;
+    };
+
+    SECTION("escapes")
+    {
+        CHECK(escape("plain text", false, false) == "plain text");
+        CHECK(escape("a\"b\\c/d", false, false) == "a\\\"b\\\\c/d");
+        CHECK(escape("a/b", false, true) == "a\\/b");
+        CHECK(escape("\b\f\n\r\t", false, false) == "\\b\\f\\n\\r\\t");
+        CHECK(escape(std::string("\x01\x1f\x7f", 3), false, false) == "\\u0001\\u001F\\u007F");
+        CHECK(escape("caf\xC3\xA9", false, false) == "caf\xC3\xA9");
+        CHECK(escape("caf\xC3\xA9", true, false) == "caf\\u00E9");
+        CHECK(escape("\xF0\x9F\x98\x80", true, false) == "\\uD83D\\uDE00");
+        CHECK_THROWS(escape("\xC3", true, false));
+    }
+
+    SECTION("runs of every length")
+    {
+        const std::vector<std::string> specials = {"\"", "\\", "/", "\n", "\x01", "\x7f", "\xC3\xA9", "\xE2\x82\xAC"};
+        for (const auto& special : specials)
+        {
+            for (std::size_t length = 0; length < 70; ++length)
+            {
+                for (std::size_t pos = 0; pos <= length; pos += 7)
+                {
+                    std::string s(length, 'x');
+                    s.insert(pos, special);
+                    for (int flags = 0; flags < 4; ++flags)
+                    {
+                        bool escape_all_non_ascii = (flags & 1) != 0;
+                        bool escape_solidus = (flags & 2) != 0;
+                        CHECK(escape(s, escape_all_non_ascii, escape_solidus) == escape_each(s, escape_all_non_ascii, escape_solidus));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,212 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_index_parser.hpp>
+#include <jsoncons/tracing_json_visitor.hpp>
+#include <catch/catch.hpp>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(JSONCONS_HAS_FILESYSTEM) && (defined(_MSC_VER) || (defined(__GNUC__) && __GNUC__ >= 9))
+#include <filesystem>
+namespace fs = std::filesystem;
+#define JSONCONS_INDEX_PARSER_TEST_SUITE
+#endif
+
+using namespace jsoncons;
+
+namespace {
+
+    struct parse_outcome
+    {
+        std::error_code ec;
+        std::string events;
+    };
+
+    parse_outcome index_parse(const std::string& input, const json_options& options = json_options{})
+    {
+        std::ostringstream os;
+        tracing_json_visitor visitor(os);
+        json_index_parser parser(options);
+        parse_outcome outcome;
+        parser.parse(input.data(), input.size(), visitor, outcome.ec);
+        outcome.events = os.str();
+        return outcome;
+    }
+
+    parse_outcome stream_parse(const std::string& input, const json_options& options = json_options{})
+    {
+        std::ostringstream os;
+        tracing_json_visitor visitor(os);
+        json_parser parser(options);
+        parse_outcome outcome;
+        parser.update(input.data(), input.size());
+        parser.parse_some(visitor, outcome.ec);
+        if (!outcome.ec)
+        {
+            parser.finish_parse(visitor, outcome.ec);
+        }
+        if (!outcome.ec)
+        {
+            parser.check_done(outcome.ec);
+        }
+        outcome.events = os.str();
+        return outcome;
+    }
+
+} // namespace
+
+TEST_CASE("json_index_parser same events as json_parser")
+{
+    std::vector<std::string> inputs = {
+        R"({"a":1,"b":[true,false,null],"c":{"d":-2.5e10,"e":"text"}})",
+        "  [ 1 , 2 ,\n\t3 ]  ",
+        R"(["esc\"aped", "back\\slash\\", "\\\"", "\u00e9\ud83d\ude00", "tab\tsep"])",
+        R"([18446744073709551616, -9223372036854775809, 0, -0, 1E400, 0.1])",
+        R"("just a string")",
+        "42",
+        "[[[[[]]]],{},{\"\":{}}]",
+        R"({"key with \"quotes\"" : "value , with : structurals { [ ] }"})",
+        std::string("[\"") + std::string(200, 'x') + "\\\\" + std::string(70, 'y') + "\"]",
+        "[\"caf\xC3\xA9\", \"\xE2\x82\xAC\"]"
+    };
+
+    for (const auto& input : inputs)
+    {
+        auto expected = stream_parse(input);
+        REQUIRE_FALSE(expected.ec);
+        auto actual = index_parse(input);
+        CHECK_FALSE(actual.ec);
+        CHECK(actual.events == expected.events);
+    }
+}
+
+TEST_CASE("json_index_parser options")
+{
+    std::string input = R"([1.5, 123456789012345678901234567890, "NaN", "Infinity"])";
+    auto options = json_options{}
+        .lossless_number(true)
+        .nan_to_str("NaN")
+        .inf_to_str("Infinity");
+
+    auto expected = stream_parse(input, options);
+    auto actual = index_parse(input, options);
+    REQUIRE_FALSE(expected.ec);
+    CHECK_FALSE(actual.ec);
+    CHECK(actual.events == expected.events);
+
+    SECTION("lazy numbers")
+    {
+        std::string numbers = R"([0, -1, 18446744073709551616, 1.5e-3, {"a":-0.25}])";
+        auto lazy = json_options{}.lazy_numbers(true);
+        auto lazy_expected = stream_parse(numbers, lazy);
+        REQUIRE_FALSE(lazy_expected.ec);
+        CHECK(index_parse(numbers, lazy).events == lazy_expected.events);
+    }
+
+    SECTION("max nesting depth")
+    {
+        auto limited = json_options{}.max_nesting_depth(2);
+        CHECK_FALSE(index_parse("[[1]]", limited).ec);
+        CHECK(index_parse("[[[1]]]", limited).ec == json_errc::max_nesting_depth_exceeded);
+    }
+}
+
+TEST_CASE("json_index_parser errors")
+{
+    std::vector<std::string> inputs = {
+        "", "   ", "[", "[1,]", "{\"a\":1,}", "[1 2]", "{\"a\" 1}", "{1:2}", "[tru]", "[truee]",
+        "[01]", "[1.]", "[-]", "[1e]", "\"unterminated", "[\"a\\x\"]", "[\"\\u12G4\"]",
+        "[\"\\ud800x\"]", "[\"a\x01\"]", "[\"\xC3\x28\"]", "[1] 2", "[1]]", "/* comment */ [1]",
+        "[nul]", "{\"a\":}", "[\"a\"\"b\"]", "1\\\"", "[1,\"a\"x]"
+    };
+
+    for (const auto& input : inputs)
+    {
+        auto actual = index_parse(input);
+        CHECK(actual.ec);
+        auto expected = stream_parse(input, json_options{}.allow_comments(false));
+        CHECK(expected.ec);
+    }
+}
+
+TEST_CASE("json::parse with the indexed parse engine")
+{
+    std::string input = "{\"records\":[";
+    for (int i = 0; i < 500; ++i)
+    {
+        if (i > 0)
+        {
+            input.push_back(',');
+        }
+        input += "{\"id\":" + std::to_string(i) + ",\"name\":\"item\\t" + std::to_string(i) + "\",\"price\":" + std::to_string(i) + ".25}";
+    }
+    input += "]}";
+
+    json expected = json::parse(input, json_options{}.parse_engine(parse_engine_kind::streaming));
+
+    SECTION("automatic")
+    {
+        CHECK(json::parse(input) == expected);
+        auto result = try_decode_json<json>(input);
+        REQUIRE(result);
+        CHECK(*result == expected);
+    }
+    SECTION("indexed")
+    {
+        CHECK(json::parse(input, json_options{}.parse_engine(parse_engine_kind::indexed)) == expected);
+    }
+    SECTION("falls back to the streaming parser for comments")
+    {
+        std::string commented = "// leading comment\n" + input;
+        CHECK(json::parse(commented, json_options{}.parse_engine(parse_engine_kind::indexed)) == expected);
+    }
+    SECTION("errors are reported by the streaming parser")
+    {
+        std::string bad = input.substr(0, input.size() - 1);
+        std::error_code ec;
+        JSONCONS_TRY
+        {
+            json::parse(bad, json_options{}.parse_engine(parse_engine_kind::indexed));
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            ec = e.code();
+        }
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
+
+#if defined(JSONCONS_INDEX_PARSER_TEST_SUITE)
+TEST_CASE("json_index_parser JSON Parsing Test Suite")
+{
+    std::string path = "./corelib/input/JSONTestSuite";
+    for (auto& p : fs::directory_iterator(path))
+    {
+        if (!(fs::is_regular_file(p) && p.path().extension() == ".json"))
+        {
+            continue;
+        }
+        std::ifstream is(p.path().c_str(), std::ios::binary);
+        std::ostringstream buffer;
+        buffer << is.rdbuf();
+        std::string input = buffer.str();
+
+        auto options = json_options{}.allow_comments(false);
+        auto expected = stream_parse(input, options);
+        auto actual = index_parse(input, options);
+        if (!actual.ec)
+        {
+            CHECK_FALSE(expected.ec);
+            CHECK(actual.events == expected.events);
+        }
+        else if (p.path().filename().string()[0] == 'n')
+        {
+            CHECK(expected.ec);
+        }
+    }
+}
+#endif
@@ -0,0 +1,229 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_lines(std::size_t count)
+    {
+        std::string text;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            text += "{\"id\":" + std::to_string(i) + ",\"tags\":[\"a\",\"b\"],\"value\":" + std::to_string(i) + ".5}\n";
+        }
+        return text;
+    }
+
+    // Fails to allocate anything larger than 1000 bytes
+    template <typename T>
+    struct small_allocator
+    {
+        using value_type = T;
+
+        small_allocator() = default;
+        template <typename U>
+        small_allocator(const small_allocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            if (n*sizeof(T) > 1000)
+            {
+                throw std::bad_alloc();
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const small_allocator&, const small_allocator&) noexcept {return true;}
+        friend bool operator!=(const small_allocator&, const small_allocator&) noexcept {return false;}
+    };
+
+    std::atomic<bool>& gate_open()
+    {
+        static std::atomic<bool> open{true};
+        return open;
+    }
+
+    // Holds back allocations larger than 1000 bytes until gate_open() is set, for at most
+    // ten seconds
+    template <typename T>
+    struct gated_allocator
+    {
+        using value_type = T;
+
+        gated_allocator() = default;
+        template <typename U>
+        gated_allocator(const gated_allocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            if (n*sizeof(T) > 1000)
+            {
+                for (int i = 0; i < 1000 && !gate_open(); ++i)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const gated_allocator&, const gated_allocator&) noexcept {return true;}
+        friend bool operator!=(const gated_allocator&, const gated_allocator&) noexcept {return false;}
+    };
+
+} // namespace
+
+TEST_CASE("json_lines_reader input order")
+{
+    std::string text = make_lines(1000);
+
+    for (std::size_t threads : {1, 2, 4})
+    {
+        std::istringstream is(text);
+        auto options = json_lines_options{}.num_threads(threads).batch_size(256).max_batches_in_flight(3);
+        json_lines_reader<json> reader(is, options);
+
+        std::vector<std::size_t> lines;
+        std::vector<json> values;
+        reader.read([&](std::size_t line, json&& j)
+        {
+            lines.push_back(line);
+            values.push_back(std::move(j));
+        });
+
+        REQUIRE(values.size() == 1000);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            CHECK(lines[i] == i + 1);
+            CHECK(values[i].at("id").as<std::size_t>() == i);
+        }
+    }
+}
+
+TEST_CASE("json_lines_reader completion order")
+{
+    SECTION("all records")
+    {
+        std::string text = make_lines(500);
+        std::istringstream is(text);
+        auto options = json_lines_options{}.num_threads(3).batch_size(100).order(lines_order::completion);
+        json_lines_reader<json> reader(is, options);
+
+        std::vector<bool> seen(500, false);
+        std::size_t count = 0;
+        reader.read([&](std::size_t line, json&& j)
+        {
+            std::size_t id = j.at("id").as<std::size_t>();
+            CHECK(line == id + 1);
+            seen[id] = true;
+            ++count;
+        });
+        CHECK(count == 500);
+        CHECK(std::find(seen.begin(), seen.end(), false) == seen.end());
+    }
+
+    SECTION("a later batch is delivered while an earlier one is still being parsed")
+    {
+        // The first batch is a single line whose long string cannot be allocated until the
+        // callback has received a record, so it can only finish after a later batch
+        using gated_json = basic_json<char,sorted_policy,gated_allocator<char>>;
+        std::string text = "\"" + std::string(2000, 'x') + "\"\n" + make_lines(20);
+        std::istringstream is(text);
+        auto options = json_lines_options{}.num_threads(2).batch_size(64).order(lines_order::completion);
+        json_lines_reader<gated_json> reader(is, options);
+
+        gate_open() = false;
+        std::vector<std::size_t> lines;
+        reader.read([&](std::size_t line, gated_json&&)
+        {
+            lines.push_back(line);
+            gate_open() = true;
+        });
+
+        REQUIRE(lines.size() == 21);
+        CHECK(lines.front() != 1);
+        std::sort(lines.begin(), lines.end());
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            CHECK(lines[i] == i + 1);
+        }
+    }
+}
+
+TEST_CASE("json_lines_reader blank lines and line endings")
+{
+    std::string text = "[1]\r\n\n   \n{\"a\":true}\r\n\"last\"";
+    json_lines_reader<json,string_source<char>> reader(text, json_lines_options{}.num_threads(2).batch_size(4));
+
+    std::vector<std::pair<std::size_t,json>> records;
+    reader.read([&](std::size_t line, json&& j)
+    {
+        records.emplace_back(line, std::move(j));
+    });
+    REQUIRE(records.size() == 3);
+    CHECK(records[0].first == 1);
+    CHECK(records[0].second == json::parse("[1]"));
+    CHECK(records[1].first == 4);
+    CHECK(records[1].second == json::parse("{\"a\":true}"));
+    CHECK(records[2].first == 5);
+    CHECK(records[2].second.as<std::string>() == "last");
+}
+
+TEST_CASE("json_lines_reader errors")
+{
+    std::string text = make_lines(100) + "{\"id\":100,}\n" + make_lines(100);
+    std::istringstream is(text);
+    json_lines_reader<json> reader(is, json_lines_options{}.num_threads(4).batch_size(64));
+
+    std::size_t count = 0;
+    std::error_code ec;
+    reader.read([&](std::size_t, json&&){ ++count; }, ec);
+    CHECK(ec == json_errc::extra_comma);
+    CHECK(count == 100);
+    CHECK(reader.line() == 101);
+    CHECK(reader.column() == 12);
+
+    std::istringstream is2(text);
+    json_lines_reader<json> reader2(is2, json_lines_options{}.num_threads(2));
+    REQUIRE_THROWS_AS(reader2.read([](std::size_t, json&&){}), ser_error);
+}
+
+TEST_CASE("json_lines_reader worker exceptions")
+{
+    using small_json = basic_json<char,sorted_policy,small_allocator<char>>;
+    std::string text = make_lines(10) + "\"" + std::string(2000, 'x') + "\"\n" + make_lines(10);
+
+    std::istringstream is(text);
+    json_lines_reader<small_json> reader(is, json_lines_options{}.num_threads(2).batch_size(64));
+    std::size_t count = 0;
+    std::error_code ec;
+    reader.read([&](std::size_t, small_json&&){ ++count; }, ec);
+    CHECK(ec == std::errc::not_enough_memory);
+    CHECK(count <= 10);
+
+    std::istringstream is2(text);
+    json_lines_reader<small_json> reader2(is2, json_lines_options{}.num_threads(2).batch_size(64));
+    REQUIRE_THROWS_AS(reader2.read([](std::size_t, small_json&&){}), std::bad_alloc);
+}
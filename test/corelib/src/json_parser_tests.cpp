@@ -390,3 +390,265 @@ TEST_CASE("json_parser skip space tests")
     }
 }
 
+
+TEST_CASE("json_parser skip indentation tests")
+{
+    std::string doc = "{\n";
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        doc += std::string(i * 3, ' ') + "\"k" + std::to_string(i) + "\" : [\n" + std::string(i * 5, ' ') + "\t 1 \r\n" + std::string(40, ' ') + "],\n\n\n";
+    }
+
+    SECTION("line and column agree with the wide character parser")
+    {
+        for (std::size_t i = 2; i < doc.size(); i += 13)
+        {
+            std::string input = doc.substr(0, i) + "?";
+            std::wstring winput(input.begin(), input.end());
+
+            json_decoder<json> decoder;
+            json_parser parser;
+            std::error_code ec;
+            parser.update(input.data(), input.size());
+            parser.parse_some(decoder, ec);
+
+            json_decoder<wjson> wdecoder;
+            wjson_parser wparser;
+            std::error_code wec;
+            wparser.update(winput.data(), winput.size());
+            wparser.parse_some(wdecoder, wec);
+
+            CHECK(ec == wec);
+            CHECK(parser.line() == wparser.line());
+            CHECK(parser.column() == wparser.column());
+            CHECK(parser.end_position() == wparser.end_position());
+        }
+    }
+    SECTION("split across chunks")
+    {
+        std::string input = doc + "\"end\":true}";
+        json expected = json::parse(input);
+        for (std::size_t i = 1; i < input.size(); i += 7)
+        {
+            json_decoder<json> decoder;
+            json_parser parser;
+            parser.update(input.data(), i);
+            parser.parse_some(decoder);
+            parser.update(input.data() + i, input.size() - i);
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+            REQUIRE(parser.done());
+            CHECK(decoder.get_result() == expected);
+            CHECK(parser.line() == 102);
+        }
+    }
+}
+
+TEST_CASE("json_parser long number tests")
+{
+    std::string input = R"([1234567890123456789, 18446744073709551615, 18446744073709551616, -9223372036854775808, -9223372036854775809, 3.14159265358979323846e-12, 12345678901234567890123456789])";
+
+    json expected(json_array_arg);
+    expected.push_back(1234567890123456789);
+    expected.push_back(18446744073709551615ull);
+    expected.push_back(18446744073709551616.0);
+    expected.push_back((std::numeric_limits<int64_t>::lowest)());
+    expected.push_back(-9223372036854775809.0);
+    expected.push_back(3.14159265358979323846e-12);
+    expected.push_back(12345678901234567890123456789.0);
+
+    SECTION("one chunk")
+    {
+        CHECK(json::parse(input) == expected);
+    }
+    SECTION("split across chunks at every offset")
+    {
+        for (std::size_t i = 1; i < input.size(); ++i)
+        {
+            json_decoder<json> decoder;
+            json_parser parser;
+            parser.update(input.data(), i);
+            parser.parse_some(decoder);
+            parser.update(input.data() + i, input.size() - i);
+            parser.parse_some(decoder);
+            parser.finish_parse(decoder);
+            REQUIRE(parser.done());
+            CHECK(decoder.get_result() == expected);
+        }
+    }
+    SECTION("bignum")
+    {
+        auto options = json_options{}.lossless_bignum(true);
+        json j = json::parse(input, options);
+        CHECK(j[2].tag() == semantic_tag::bigint);
+        CHECK(j[2].as_string() == "18446744073709551616");
+        CHECK(j[4].as_string() == "-9223372036854775809");
+    }
+}
+
+namespace {
+
+    class string_view_recorder : public jsoncons::default_json_visitor
+    {
+    public:
+        std::vector<jsoncons::string_view> views;
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_key(const string_view_type& s, const ser_context&, std::error_code&) override
+        {
+            views.push_back(s);
+            JSONCONS_VISITOR_RETURN;
+        }
+
+        JSONCONS_VISITOR_RETURN_TYPE visit_string(const string_view_type& s, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            views.push_back(s);
+            JSONCONS_VISITOR_RETURN;
+        }
+    };
+
+    struct parse_trace
+    {
+        std::error_code ec;
+        std::size_t line{0};
+        std::size_t column{0};
+        std::string events;
+    };
+
+    parse_trace trace_parse(const std::string& input, bool in_place, std::size_t split = 0)
+    {
+        std::string buffer = input;
+        std::ostringstream os;
+        tracing_json_visitor visitor(os);
+        json_parser parser;
+        parse_trace trace;
+
+        if (split == 0)
+        {
+            split = buffer.size();
+        }
+        if (in_place)
+        {
+            parser.update_in_place(&buffer[0], split);
+        }
+        else
+        {
+            parser.update(buffer.data(), split);
+        }
+        parser.parse_some(visitor, trace.ec);
+        if (!trace.ec && split < buffer.size())
+        {
+            if (in_place)
+            {
+                parser.update_in_place(&buffer[split], buffer.size() - split);
+            }
+            else
+            {
+                parser.update(buffer.data() + split, buffer.size() - split);
+            }
+            parser.parse_some(visitor, trace.ec);
+        }
+        if (!trace.ec)
+        {
+            parser.finish_parse(visitor, trace.ec);
+        }
+        if (!trace.ec)
+        {
+            parser.check_done(trace.ec);
+        }
+        trace.line = parser.line();
+        trace.column = parser.column();
+        trace.events = os.str();
+        return trace;
+    }
+
+} // namespace
+
+TEST_CASE("json_parser update_in_place tests")
+{
+    SECTION("same events as update")
+    {
+        std::vector<std::string> inputs = {
+            R"({"a":1,"b":[true,false,null],"c":{"d":-2.5e10,"e":"text"}})",
+            R"(["esc\"aped", "back\\slash\\", "\\\"", "é😀", "tab\tsep", "\/\b\f\n\r"])",
+            R"({"key with \"quotes\"" : "value", "kAy": "€€"})",
+            R"(["", "\\", "\"", "a\\", "\\a"])",
+            std::string("[\"") + std::string(200, 'x') + "\\\\" + std::string(70, 'y') + "\"]",
+            "[\"caf\xC3\xA9\\n\", \"\xE2\x82\xAC\\t\xE2\x82\xAC\"]",
+            R"(["\udc00", "\uD834\uDD1E"])"
+        };
+
+        for (const auto& input : inputs)
+        {
+            auto expected = trace_parse(input, false);
+            REQUIRE_FALSE(expected.ec);
+            auto actual = trace_parse(input, true);
+            CHECK_FALSE(actual.ec);
+            CHECK(actual.events == expected.events);
+
+            for (std::size_t split = 1; split < input.size(); ++split)
+            {
+                auto actual_split = trace_parse(input, true, split);
+                CHECK_FALSE(actual_split.ec);
+                CHECK(actual_split.events == expected.events);
+            }
+        }
+    }
+
+    SECTION("strings point into the buffer")
+    {
+        std::string buffer = R"({"name":["plain","esc\"aped","😀 é"]})";
+        string_view_recorder visitor;
+        json_parser parser;
+        parser.update_in_place(&buffer[0], buffer.size());
+        parser.parse_some(visitor);
+        parser.finish_parse(visitor);
+        parser.check_done();
+
+        REQUIRE(visitor.views.size() == 4);
+        CHECK(visitor.views[0] == "name");
+        CHECK(visitor.views[1] == "plain");
+        CHECK(visitor.views[2] == "esc\"aped");
+        CHECK(visitor.views[3] == "\xF0\x9F\x98\x80 \xC3\xA9");
+        for (const auto& sv : visitor.views)
+        {
+            CHECK(sv.data() >= buffer.data());
+            CHECK(sv.data() + sv.size() <= buffer.data() + buffer.size());
+        }
+    }
+
+    SECTION("escaped strings into json_encoder")
+    {
+        std::string input = R"(["a\"b","c\\d\n","plain",{"k\"ey":"\u00e9\t"}])";
+        std::string buffer = input;
+        std::string output;
+        compact_json_string_encoder encoder(output);
+        json_parser parser;
+        parser.update_in_place(&buffer[0], buffer.size());
+        parser.parse_some(encoder);
+        parser.finish_parse(encoder);
+        parser.check_done();
+        encoder.flush();
+
+        CHECK(output == std::string(R"(["a\"b","c\\d\n","plain",{"k\"ey":")") + "\xC3\xA9" + R"(\t"}])");
+        json j = json::parse(output);
+        CHECK(j == json::parse(input));
+    }
+
+    SECTION("errors")
+    {
+        std::vector<std::string> inputs = {
+            R"(["a\x"])", R"(["\u12G4"])", R"(["\ud800x"])", R"(["\ud800\x"])", "[\"a\x01\"]",
+            "[\"a\\n\tb\"]", "[\"\xC3\x28\"]", R"(["é\)", R"(["abc)", R"(["\u00e)"
+        };
+
+        for (const auto& input : inputs)
+        {
+            auto expected = trace_parse(input, false);
+            REQUIRE(expected.ec);
+            auto actual = trace_parse(input, true);
+            CHECK(actual.ec == expected.ec);
+            CHECK(actual.line == expected.line);
+            CHECK(actual.column == expected.column);
+        }
+    }
+}
@@ -0,0 +1,159 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_reclaimer.hpp>
+#include <catch/catch.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::atomic<std::size_t> live_allocations{0};
+    std::atomic<std::size_t> deallocations_on_main_thread{0};
+    std::thread::id main_thread_id;
+
+    template <typename T>
+    struct counting_allocator
+    {
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        counting_allocator() = default;
+
+        template <typename U>
+        counting_allocator(const counting_allocator<U>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            ++live_allocations;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            --live_allocations;
+            if (std::this_thread::get_id() == main_thread_id)
+            {
+                ++deallocations_on_main_thread;
+            }
+            std::allocator<T>().deallocate(ptr, n);
+        }
+
+        friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept
+        {
+            return true;
+        }
+
+        friend bool operator!=(const counting_allocator&, const counting_allocator&) noexcept
+        {
+            return false;
+        }
+    };
+
+    using counted_json = basic_json<char,sorted_policy,counting_allocator<char>>;
+
+    counted_json make_document(std::size_t n)
+    {
+        counted_json doc(json_array_arg);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            counted_json item(json_object_arg);
+            item.try_emplace("id", i);
+            item.try_emplace("name", "a name that is too long to be stored in place");
+            item.try_emplace("values", counted_json(json_array_arg, {1, 2, 3}));
+            doc.push_back(std::move(item));
+        }
+        return doc;
+    }
+
+    template <typename Json>
+    Json make_nested(std::size_t depth)
+    {
+        Json j(json_array_arg);
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            Json outer(json_object_arg);
+            outer.try_emplace("a", std::move(j));
+            Json array(json_array_arg);
+            array.push_back(std::move(outer));
+            j = std::move(array);
+        }
+        return j;
+    }
+
+} // namespace
+
+TEST_CASE("deeply nested destruction tests")
+{
+    SECTION("json")
+    {
+        json j = make_nested<json>(500000);
+        CHECK(j.size() == 1);
+    }
+    SECTION("ojson")
+    {
+        ojson j = make_nested<ojson>(500000);
+        CHECK(j.size() == 1);
+    }
+}
+
+TEST_CASE("basic_json_reclaimer tests")
+{
+    main_thread_id = std::this_thread::get_id();
+    const std::size_t baseline = live_allocations;
+
+    SECTION("values are destroyed on the reclaimer thread")
+    {
+        basic_json_reclaimer<counted_json> reclaimer;
+        {
+            counted_json doc = make_document(1000);
+            CHECK(live_allocations > baseline);
+            deallocations_on_main_thread = 0;
+            reclaimer.reclaim(std::move(doc));
+        }
+        reclaimer.wait();
+        CHECK(deallocations_on_main_thread == 0);
+        CHECK(live_allocations == baseline);
+    }
+
+    SECTION("pending values are destroyed by the destructor")
+    {
+        {
+            basic_json_reclaimer<counted_json> reclaimer;
+            for (int i = 0; i < 10; ++i)
+            {
+                reclaimer.reclaim(make_document(100));
+            }
+        }
+        CHECK(live_allocations == baseline);
+    }
+
+    SECTION("cheap values are destroyed in place")
+    {
+        basic_json_reclaimer<counted_json> reclaimer;
+        deallocations_on_main_thread = 0;
+        reclaimer.reclaim(counted_json("a string that is too long to be stored in place"));
+        reclaimer.reclaim(counted_json(json_array_arg));
+        CHECK(deallocations_on_main_thread == 2);
+        CHECK(live_allocations == baseline);
+    }
+
+    SECTION("deferred_destroy")
+    {
+        deferred_destroy(make_document(1000));
+        basic_json_reclaimer<counted_json>::instance().wait();
+        CHECK(live_allocations == baseline);
+
+        json j = json::parse(R"({"a":[1,2,{"b":null}]})");
+        deferred_destroy(std::move(j));
+        json_reclaimer::instance().wait();
+    }
+}
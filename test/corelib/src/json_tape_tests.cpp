@@ -0,0 +1,298 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_tape.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <catch/catch.hpp>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json_tape parse and dump tests")
+{
+    std::vector<std::string> inputs = {
+        R"(null)",
+        R"(true)",
+        R"(-17)",
+        R"(18446744073709551615)",
+        R"(1.5e300)",
+        R"("")",
+        R"("1234567")",
+        R"("12345678")",
+        R"("été 😀")",
+        R"([])",
+        R"({})",
+        R"([[],[[]],{},{"a":[]}])",
+        R"({"a":1,"b":[true,false,null],"c":{"d":"e","f":{"g":-2.5}},"h":"a longer string value"})",
+        R"({"a":1,"a":2})"
+    };
+
+    for (const auto& input : inputs)
+    {
+        json_tape tape = json_tape::parse(input);
+        json expected = json::parse(input);
+
+        CHECK(tape.root().as<json>() == expected);
+        CHECK(json::parse(tape.root().to_string()) == expected);
+        CHECK(tape.root().type() == expected.type());
+    }
+}
+
+TEST_CASE("json_tape navigation tests")
+{
+    std::string input = R"(
+{
+    "books": [
+        {"title": "Pulp", "price": 22.72, "stock": 3},
+        {"title": "Sword of Honour", "price": 12.5, "stock": 0},
+        {"title": "Chapterhouse: Dune", "price": 15, "tags": ["sf", "dune"]}
+    ],
+    "count": 3,
+    "big": 18446744073709551615,
+    "owner": null
+}
+    )";
+
+    json_tape tape = json_tape::parse(input);
+    const json_tape_value& root = tape.root();
+
+    SECTION("object access")
+    {
+        REQUIRE(root.is_object());
+        CHECK(root.size() == 4);
+        CHECK(root.contains("books"));
+        CHECK_FALSE(root.contains("title"));
+        CHECK(root["count"].as<int>() == 3);
+        CHECK(root.at("big").as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+        CHECK(root.at("owner").is_null());
+        CHECK(root.find("nothing") == root.object_range().end());
+        CHECK_THROWS_AS(root.at("nothing"), std::out_of_range);
+
+        std::vector<std::string> keys;
+        for (const auto& member : root.object_range())
+        {
+            keys.emplace_back(member.key());
+        }
+        CHECK(keys == std::vector<std::string>{"books", "count", "big", "owner"});
+    }
+
+    SECTION("array access")
+    {
+        const json_tape_value& books = root["books"];
+        REQUIRE(books.is_array());
+        CHECK(books.size() == 3);
+        CHECK(books[1]["title"].as_string_view() == "Sword of Honour");
+        CHECK(books[0]["price"].as<double>() == 22.72);
+        CHECK(books[2]["price"].is_uint64());
+        CHECK(books[2]["tags"][1].as<std::string>() == "dune");
+        CHECK_THROWS_AS(books[3], std::out_of_range);
+
+        double total = 0;
+        for (const auto& book : books.array_range())
+        {
+            total += book["price"].as_double();
+        }
+        CHECK(total == 22.72 + 12.5 + 15);
+    }
+
+    SECTION("values are references into the tape")
+    {
+        const json_tape_value& books = root["books"];
+        CHECK(&books == &root.object_range().begin()->value());
+        CHECK(&books[2] == &*std::next(books.array_range().begin(), 2));
+    }
+
+    SECTION("non-string as_string")
+    {
+        CHECK(root["books"][2]["tags"].as_string() == R"(["sf","dune"])");
+        CHECK(root["count"].as_string() == "3");
+    }
+
+    SECTION("type errors")
+    {
+        CHECK_THROWS(root["count"]["a"]);
+        CHECK_THROWS(root["count"][0]);
+        CHECK_THROWS(root["count"].as_string_view());
+        CHECK_THROWS(root["owner"].as_bool());
+        CHECK_THROWS(root.array_range());
+    }
+
+    SECTION("conversion")
+    {
+        json j = root["books"][0].as<json>();
+        CHECK(j == json::parse(R"({"title": "Pulp", "price": 22.72, "stock": 3})"));
+
+        ojson o = root.as<ojson>();
+        CHECK(o.object_range().begin()->key() == "books");
+
+        auto prices = root["books"][2]["tags"].as<std::vector<std::string>>();
+        CHECK(prices == std::vector<std::string>{"sf", "dune"});
+    }
+}
+
+TEST_CASE("json_tape skips large subtrees")
+{
+    json j(json_array_arg);
+    for (int i = 0; i < 1000; ++i)
+    {
+        json item;
+        item.try_emplace("id", i);
+        item.try_emplace("name", std::string("item ") + std::to_string(i));
+        item.try_emplace("values", json(json_array_arg, {i, i + 1, i + 2}));
+        j.push_back(std::move(item));
+    }
+    json doc;
+    doc.try_emplace("items", std::move(j));
+    doc.try_emplace("last", "end");
+
+    std::string input = doc.to_string();
+    json_tape tape = json_tape::parse(input);
+
+    CHECK(tape.root()["last"].as_string_view() == "end");
+    CHECK(tape.root()["items"][999]["values"][2].as<int>() == 1001);
+    CHECK(tape.root()["items"][500]["name"].as_string() == "item 500");
+    CHECK(tape.root().as<json>() == doc);
+}
+
+TEST_CASE("json_tape jsonpointer tests")
+{
+    json_tape tape = json_tape::parse(R"({"a":{"b":["c","d",{"e/f":1}]}})");
+
+    CHECK(jsonpointer::get(tape.root(), "/a/b/1").as_string_view() == "d");
+    CHECK(jsonpointer::get(tape.root(), "/a/b/2/e~1f").as<int>() == 1);
+
+    std::error_code ec;
+    jsonpointer::get(tape.root(), "/a/x", ec);
+    CHECK(ec == jsonpointer::jsonpointer_errc::key_not_found);
+}
+
+TEST_CASE("json_tape istream and errors tests")
+{
+    SECTION("istream")
+    {
+        std::istringstream is(R"({"a":[1,2,3]})");
+        json_tape tape = json_tape::parse(is);
+        CHECK(tape.root()["a"][2].as<int>() == 3);
+    }
+
+    SECTION("syntax error")
+    {
+        CHECK_THROWS_AS(json_tape::parse(R"({"a":[1,2,})"), ser_error);
+        CHECK_THROWS_AS(json_tape::parse(""), ser_error);
+    }
+
+    SECTION("default is null")
+    {
+        json_tape tape;
+        CHECK(tape.root().is_null());
+        CHECK(tape.tape_size() == 1);
+    }
+
+    SECTION("copy and move")
+    {
+        json_tape tape = json_tape::parse(R"({"a":"b"})");
+        json_tape copy(tape);
+        CHECK(copy.root()["a"].as_string_view() == "b");
+
+        json_tape other;
+        other = std::move(copy);
+        CHECK(other.root()["a"].as_string_view() == "b");
+        other = tape;
+        CHECK(other.root().size() == 1);
+    }
+}
+
+TEST_CASE("json_tape from basic_json tests")
+{
+    std::vector<uint8_t> bytes = {'H','e','l','l','o','!','!','!','!'};
+    json j(json_array_arg);
+    j.emplace_back(byte_string_arg, bytes, semantic_tag::base64);
+    j.emplace_back(byte_string_arg, bytes, 42);
+    j.emplace_back(byte_string_arg, std::vector<uint8_t>{});
+    j.emplace_back("2015-05-07 12:41:07-07:00", semantic_tag::datetime);
+    j.emplace_back(half_arg, 0x3c00);
+
+    json_tape tape(j);
+    const json_tape_value& root = tape.root();
+
+    REQUIRE(root.size() == 5);
+    CHECK(root[0].tag() == semantic_tag::base64);
+    CHECK(root[0].as_byte_string_view() == byte_string_view(bytes));
+    CHECK(root[1].tag() == semantic_tag::ext);
+    CHECK(root[1].as_byte_string_view() == byte_string_view(bytes));
+    CHECK(root[2].empty());
+    CHECK(root[3].tag() == semantic_tag::datetime);
+    CHECK(root[4].as_double() == 1.0);
+
+    json k = root.as<json>();
+    CHECK(k[0] == j[0]);
+    CHECK(k[1].ext_tag() == 42);
+    CHECK(k[1] == j[1]);
+    CHECK(k[3].tag() == semantic_tag::datetime);
+    CHECK(root.to_string() == j.to_string());
+}
+
+TEST_CASE("json_tape number text tests")
+{
+    SECTION("out of range exponents")
+    {
+        json_tape tape = json_tape::parse("[1e400,1E-400,-1e400]");
+        const json_tape_value& root = tape.root();
+        json j = json::parse("[1e400,1E-400,-1e400]");
+
+        for (std::size_t i = 0; i < root.size(); ++i)
+        {
+            CHECK(root[i].tag() == semantic_tag::bigdec);
+            CHECK(root[i].is_string());
+            CHECK(root[i].is_number());
+            CHECK(root[i].is_double());
+            CHECK_FALSE(root[i].is_int64());
+            CHECK(root[i].as_double() == j[i].as<double>());
+        }
+        CHECK(root[0].as_double() == std::numeric_limits<double>::infinity());
+        CHECK(root[1].as_double() == 0.0);
+    }
+
+    SECTION("lossless_number")
+    {
+        auto options = json_options{}.lossless_number(true);
+        json_tape tape = json_tape::parse("[1.5,18446744073709551616,-5]", options);
+        const json_tape_value& root = tape.root();
+
+        CHECK(root[0].is_double());
+        CHECK(root[0].as_double() == 1.5);
+        CHECK(root[1].tag() == semantic_tag::bigint);
+        CHECK(root[1].is_number());
+        CHECK_FALSE(root[1].is_uint64());
+        CHECK(root[2].is_int64());
+    }
+
+    SECTION("signs")
+    {
+        json_tape tape = json_tape::parse("[-0,0,18446744073709551615]");
+        const json_tape_value& root = tape.root();
+        json j = json::parse("[-0,0,18446744073709551615]");
+
+        for (std::size_t i = 0; i < root.size(); ++i)
+        {
+            CHECK(root[i].is_int64() == j[i].is_int64());
+            CHECK(root[i].is_uint64() == j[i].is_uint64());
+        }
+        CHECK(root[0].is_uint64());
+        CHECK_FALSE(root[2].is_int64());
+    }
+
+    SECTION("duplicate keys are kept")
+    {
+        json_tape tape = json_tape::parse(R"({"a":1,"a":2})");
+        const json_tape_value& root = tape.root();
+
+        CHECK(root.size() == 2);
+        CHECK(root["a"].as<int>() == 1);
+        CHECK(root.to_string() == R"({"a":1,"a":2})");
+    }
+}
@@ -0,0 +1,223 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_view.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Materializes a view one value at a time through the view's own interface
+    json to_json(const json_view& view)
+    {
+        switch (view.type())
+        {
+            case json_type::null_value:
+                return json::null();
+            case json_type::bool_value:
+                return json(view.as_bool());
+            case json_type::int64_value:
+                return json(view.as<int64_t>());
+            case json_type::uint64_value:
+                return json(view.as<uint64_t>());
+            case json_type::double_value:
+                return json(view.as_double());
+            case json_type::string_value:
+                return json(view.as_string());
+            case json_type::array_value:
+            {
+                json j(json_array_arg);
+                for (const auto& item : view.array_range())
+                {
+                    j.push_back(to_json(item));
+                }
+                return j;
+            }
+            default:
+            {
+                json j(json_object_arg);
+                for (const auto& member : view.object_range())
+                {
+                    j.try_emplace(member.key(), to_json(member.value()));
+                }
+                return j;
+            }
+        }
+    }
+
+    const std::string books = R"(
+{
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99,
+             "tags" : ["war", "\"satire\"", "[{,}]"]},
+            {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings",
+             "isbn": "0-395-19395-8", "price": 22.99, "in stock": true, "copies": -3, "rating": null}
+        ],
+        "bicycle": {"color": "red", "price": 19.95e0},
+        "kéy\\": "esc\"aped\n𝄞",
+        "big": 18446744073709551615,
+        "bigger": 18446744073709551616
+    }
+}
+    )";
+
+} // namespace
+
+TEST_CASE("json_view tests")
+{
+    json_view view(books);
+
+    SECTION("compare with json")
+    {
+        CHECK(to_json(view) == json::parse(books));
+        CHECK(view.as<json>() == json::parse(books));
+    }
+    SECTION("access")
+    {
+        const json_view& store = view["store"];
+        CHECK(store.is_object());
+        CHECK(store.size() == 5);
+        CHECK(store["book"].size() == 3);
+        CHECK(store["book"][1]["author"].as<std::string>() == "Evelyn Waugh");
+        CHECK(store["book"][1]["author"].as<jsoncons::string_view>() == "Evelyn Waugh");
+        CHECK(store["book"][1]["tags"][1].as_string() == "\"satire\"");
+        CHECK(store["book"][1]["tags"][2].as_string() == "[{,}]");
+        CHECK(store["book"][2]["in stock"].as<bool>());
+        CHECK(store["book"][2]["copies"].as<int>() == -3);
+        CHECK(store["book"][2]["copies"].is_int64());
+        CHECK(store["book"][2]["rating"].is_null());
+        CHECK(store["book"][0]["price"].as<double>() == 8.95);
+        CHECK(store["book"][0]["price"].as<int>() == 8);
+        CHECK(store["bicycle"]["price"].is_double());
+        CHECK(store["big"].is_uint64());
+        CHECK_FALSE(store["big"].is_int64());
+        CHECK(store["bigger"].is_double());
+        CHECK(store["bicycle"].raw_text() == R"({"color": "red", "price": 19.95e0})");
+        CHECK(store["bicycle"].as<json>() == json::parse(R"({"color": "red", "price": 19.95})"));
+        CHECK(store["book"][1]["tags"].as<std::vector<std::string>>() ==
+              std::vector<std::string>{"war", "\"satire\"", "[{,}]"});
+    }
+    SECTION("escaped keys and strings")
+    {
+        const json_view& store = view["store"];
+        CHECK(store.contains("k\xC3\xA9y\\"));
+        CHECK_FALSE(store.contains("k\\u00e9y\\\\"));
+        CHECK(store["k\xC3\xA9y\\"].as_string() == "esc\"aped\n\xF0\x9D\x84\x9E");
+    }
+    SECTION("missing values")
+    {
+        CHECK_FALSE(view["store"].contains("author"));
+        CHECK(view["store"].find("author") == view["store"].object_range().end());
+        REQUIRE_THROWS_AS(view["store"].at("author"), key_not_found);
+        REQUIRE_THROWS_AS(view["store"]["book"].at(3), std::out_of_range);
+        REQUIRE_THROWS_AS(view["store"]["book"].at("author"), not_an_object);
+        REQUIRE_THROWS_AS(view["store"]["bicycle"]["color"].as_bool(), std::domain_error);
+    }
+    SECTION("children are views of the same text")
+    {
+        const json_view& color = view["store"]["bicycle"]["color"];
+        CHECK(std::addressof(view["store"]["bicycle"]["color"]) == std::addressof(color));
+        CHECK(color.raw_text().data() > books.data());
+        CHECK(color.raw_text().data() < books.data() + books.size());
+    }
+}
+
+TEST_CASE("json_view jsonpointer tests")
+{
+    const json_view view(books);
+    json j = json::parse(books);
+
+    std::vector<std::string> pointers = {"", "/store/book/0", "/store/book/1/tags/2", "/store/bicycle/price",
+        "/store/book/2/in stock", "/store/k\xC3\xA9y\\"};
+    for (const auto& pointer : pointers)
+    {
+        const json_view& v = jsonpointer::get(view, pointer);
+        CHECK(to_json(v) == jsonpointer::get(j, pointer));
+    }
+
+    std::error_code ec;
+    jsonpointer::get(view, "/store/book/3", ec);
+    CHECK(ec == jsonpointer::jsonpointer_errc::index_exceeds_array_size);
+    ec.clear();
+    jsonpointer::get(view, "/store/author", ec);
+    CHECK(ec == jsonpointer::jsonpointer_errc::key_not_found);
+}
+
+TEST_CASE("json_view scalars and empty containers")
+{
+    CHECK(json_view(" [] ").empty());
+    CHECK(json_view("{ }").size() == 0);
+    CHECK(json_view("\"\"").empty());
+    CHECK(json_view(" 0 ").as<int>() == 0);
+    CHECK(json_view("-0.5e-1").as<double>() == -0.05);
+    std::string long_number = "[0." + std::string(100, '5') + "]";
+    CHECK(json_view(long_number)[0].as<double>() == json::parse(long_number)[0].as<double>());
+    CHECK(wjson_view(L"[2.5]")[0].as<double>() == 2.5);
+    CHECK(json_view("false").is_bool());
+    CHECK(json_view("[[1,[2]],{\"a\":[]},3]")[2].as<int>() == 3);
+    CHECK(wjson_view(L"{\"a\":[1,\"b\"]}")[L"a"][1].as_string() == L"b");
+}
+
+TEST_CASE("json_view errors")
+{
+    struct test_case
+    {
+        std::string text;
+        std::error_code ec;
+        std::size_t line;
+        std::size_t column;
+    };
+
+    std::vector<test_case> tests = {
+        {"", json_errc::unexpected_eof, 1, 1},
+        {"[1,2", json_errc::unexpected_eof, 1, 5},
+        {"[1 2]", json_errc::expected_comma_or_rbracket, 1, 4},
+        {"{\"a\" 1}", json_errc::expected_colon, 1, 6},
+        {"{1:2}", json_errc::expected_key, 1, 2},
+        {"[1,\n\"abc]", json_errc::unexpected_eof, 2, 6},
+        {"[1,\n  ]", json_errc::syntax_error, 2, 3},
+        {"[01]", json_errc::invalid_number, 1, 3},
+        {"[1.]", json_errc::invalid_number, 1, 4},
+        {"[tru]", json_errc::invalid_value, 1, 2},
+        {"[[}]", json_errc::unexpected_rbrace, 1, 3},
+        {"[[1,{\"a\":\"]\"}}]", json_errc::unexpected_rbrace, 1, 14},
+        {"[{\"a\":[1]]}", json_errc::unexpected_rbracket, 1, 10}
+    };
+
+    for (const auto& test : tests)
+    {
+        std::error_code ec;
+        std::size_t line = 0;
+        std::size_t column = 0;
+        JSONCONS_TRY
+        {
+            json_view view(test.text);
+            for (std::size_t i = 0; i < view.size(); ++i)
+            {
+                view[i].type();
+            }
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            ec = e.code();
+            line = e.line();
+            column = e.column();
+        }
+        CHECK(ec == test.ec);
+        CHECK(line == test.line);
+        CHECK(column == test.column);
+    }
+
+    // Values that are not accessed are not checked
+    json_view view("[1, tru, 2]");
+    CHECK(view[0].as<int>() == 1);
+    CHECK(view[2].as<int>() == 2);
+    REQUIRE_THROWS_AS(view[1].type(), ser_error);
+}
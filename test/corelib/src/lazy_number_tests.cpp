@@ -0,0 +1,113 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <string>
+
+using namespace jsoncons;
+
+TEST_CASE("lazy_numbers parse tests")
+{
+    auto options = json_options{}.lazy_numbers(true);
+
+    SECTION("numbers are kept as text")
+    {
+        json j = json::parse(R"([17, -42, 0.1, 1e400, 18446744073709551616])", options);
+
+        CHECK(j[0].as_string_view() == "17");
+        CHECK(j[0].tag() == semantic_tag::bigint);
+        CHECK(j[1].as_string_view() == "-42");
+        CHECK(j[2].as_string_view() == "0.1");
+        CHECK(j[2].tag() == semantic_tag::bigdec);
+        CHECK(j[3].as_string_view() == "1e400");
+        CHECK(j[4].as_string_view() == "18446744073709551616");
+    }
+
+    SECTION("numbers are written back verbatim")
+    {
+        std::string input = R"({"a":0.10000000000000000555,"b":[1.0,-0.0,2.50e+10],"c":12345678901234567890123})";
+        json j = json::parse(input, options);
+
+        std::string output;
+        j.dump(output);
+        CHECK(output == input);
+    }
+
+    SECTION("type queries")
+    {
+        json j = json::parse(R"([17, -42, 0.5, 18446744073709551616])", options);
+
+        CHECK(j[0].is_number());
+        CHECK(j[0].is_int64());
+        CHECK(j[0].is_uint64());
+        CHECK_FALSE(j[0].is_double());
+        CHECK(j[0].is<int>());
+        CHECK(j[0].is<uint8_t>());
+
+        CHECK(j[1].is_int64());
+        CHECK_FALSE(j[1].is_uint64());
+        CHECK_FALSE(j[1].is<unsigned>());
+
+        CHECK(j[2].is_number());
+        CHECK(j[2].is_double());
+        CHECK_FALSE(j[2].is_int64());
+
+        CHECK(j[3].is_number());
+        CHECK_FALSE(j[3].is_int64());
+        CHECK_FALSE(j[3].is_uint64());
+    }
+
+    SECTION("conversions")
+    {
+        json j = json::parse(R"([17, -42, 0.5, 2.75, 18446744073709551616])", options);
+
+        CHECK(j[0].as<int>() == 17);
+        CHECK(j[0].as<double>() == 17.0);
+        CHECK(j[1].as<int64_t>() == -42);
+        CHECK(j[2].as<double>() == 0.5);
+        CHECK(j[3].as<int>() == 2);
+        CHECK(j[4].as<double>() == 18446744073709551616.0);
+        CHECK(j[4].as<std::string>() == "18446744073709551616");
+    }
+
+    SECTION("decimal text out of the integer range")
+    {
+        json j = json::parse(R"([1e400, -1e400, 300.5, -0.5, 9.3e18, -9.2e18])", options);
+
+        CHECK_FALSE(j[0].try_as_integer<int64_t>());
+        CHECK(j[0].try_as_integer<int64_t>().error().code() == conv_errc::not_integer);
+        CHECK_FALSE(j[1].try_as_integer<int64_t>());
+        CHECK_FALSE(j[2].try_as_integer<uint8_t>());
+        CHECK(j[2].as<int16_t>() == 300);
+        CHECK(j[3].as<unsigned>() == 0);
+        CHECK_FALSE(j[4].try_as_integer<int64_t>());
+        CHECK(j[4].as<uint64_t>() == 9300000000000000000u);
+        CHECK(j[5].as<int64_t>() == -9200000000000000000);
+        CHECK_FALSE(j[5].try_as_integer<uint64_t>());
+    }
+
+    SECTION("short numbers are stored inline")
+    {
+        json j = json::parse("[1234567]", options);
+        CHECK(j[0].storage_kind() == json_storage_kind::short_str);
+    }
+}
+
+TEST_CASE("lazy_numbers with other options")
+{
+    SECTION("without lazy_numbers")
+    {
+        json j = json::parse("[17, 0.5]");
+        CHECK(j[0].storage_kind() == json_storage_kind::uint64);
+        CHECK(j[1].storage_kind() == json_storage_kind::float64);
+    }
+
+    SECTION("lazy_numbers overrides lossless_bignum")
+    {
+        auto options = json_options{}.lazy_numbers(true).lossless_bignum(false);
+        json j = json::parse("[18446744073709551616]", options);
+        CHECK(j[0].as_string_view() == "18446744073709551616");
+    }
+}
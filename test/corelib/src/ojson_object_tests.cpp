@@ -3,12 +3,14 @@
 
 #include <jsoncons/json.hpp>
 #include <jsoncons/json_encoder.hpp>
+#include <algorithm>
 #include <sstream>
 #include <vector>
 #include <utility>
 #include <ctime>
 #include <map>
 #include <iterator>
+#include <random>
 #include <catch/catch.hpp>
 
 using namespace jsoncons;
@@ -438,6 +440,122 @@ TEST_CASE("test_ojson_merge_or_update_move")
     }
 }
 
+TEST_CASE("ojson large object tests")
+{
+    SECTION("random operations keep order")
+    {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> key_dist(0, 499);
+        std::uniform_int_distribution<int> op_dist(0, 3);
+
+        ojson j(json_object_arg);
+        std::vector<std::pair<std::string,int>> model;
+        auto model_find = [&](const std::string& key)
+        {
+            return std::find_if(model.begin(), model.end(),
+                [&](const std::pair<std::string,int>& item) {return item.first == key;});
+        };
+
+        for (int i = 0; i < 5000; ++i)
+        {
+            std::string key = "key" + std::to_string(key_dist(gen));
+            auto it = model_find(key);
+            switch (op_dist(gen))
+            {
+                case 0:
+                {
+                    auto result = j.insert_or_assign(key, i);
+                    CHECK(result.second == (it == model.end()));
+                    CHECK(result.first->key() == key);
+                    if (it == model.end())
+                    {
+                        model.emplace_back(key, i);
+                    }
+                    else
+                    {
+                        it->second = i;
+                    }
+                    break;
+                }
+                case 1:
+                {
+                    auto result = j.try_emplace(key, i);
+                    CHECK(result.second == (it == model.end()));
+                    CHECK(result.first->key() == key);
+                    if (it == model.end())
+                    {
+                        model.emplace_back(key, i);
+                    }
+                    break;
+                }
+                case 2:
+                    CHECK(j.erase(key) == (it == model.end() ? 0 : 1));
+                    if (it != model.end())
+                    {
+                        model.erase(it);
+                    }
+                    break;
+                default:
+                    CHECK(j.contains(key) == (it != model.end()));
+                    break;
+            }
+        }
+
+        REQUIRE(j.size() == model.size());
+        std::size_t i = 0;
+        for (const auto& member : j.object_range())
+        {
+            CHECK(member.key() == model[i].first);
+            CHECK(member.value().as<int>() == model[i].second);
+            CHECK(j.at(model[i].first).as<int>() == model[i].second);
+            ++i;
+        }
+    }
+
+    SECTION("erase range and clear")
+    {
+        ojson j(json_object_arg);
+        for (int i = 0; i < 100; ++i)
+        {
+            j.try_emplace(std::to_string(i), i);
+        }
+        auto range = j.object_range();
+        j.erase(range.begin() + 10, range.begin() + 60);
+        CHECK(j.size() == 50);
+        CHECK(j.at("9").as<int>() == 9);
+        CHECK(j.at("60").as<int>() == 60);
+        CHECK_FALSE(j.contains("10"));
+        CHECK_FALSE(j.contains("59"));
+        CHECK((j.object_range().begin() + 10)->key() == "60");
+
+        ojson copy(j);
+        j.clear();
+        CHECK_FALSE(j.contains("99"));
+        j.try_emplace("99", 0);
+        CHECK(j.at("99").as<int>() == 0);
+        CHECK(copy.at("99").as<int>() == 99);
+
+        copy.shrink_to_fit();
+        CHECK(copy.at("70").as<int>() == 70);
+    }
+
+    SECTION("parse with duplicate keys")
+    {
+        std::string input = "{";
+        for (int i = 0; i < 600; ++i)
+        {
+            input += "\"" + std::to_string(i % 400) + "\":" + std::to_string(i) + ",";
+        }
+        input.back() = '}';
+
+        ojson j = ojson::parse(input);
+        CHECK(j.size() == 400);
+        CHECK(j.at("0").as<int>() == 0);
+        CHECK(j.at("399").as<int>() == 399);
+        CHECK(j.object_range().begin()->key() == "0");
+    }
+}
+
 #if defined(JSONCONS_HAS_STATEFUL_ALLOCATOR) && JSONCONS_HAS_STATEFUL_ALLOCATOR == 1
 
 #include <common/mock_stateful_allocator.hpp>
@@ -623,4 +741,22 @@ TEST_CASE("cust_json merge_or_update test")
     }
 }
 
+TEST_CASE("cust_json try_emplace returns the new member")
+{
+    MyScopedAllocator<char> alloc(1);
+
+    cust_json doc(json_object_arg, alloc);
+    for (int i = 0; i < 40; ++i)
+    {
+        auto result = doc.try_emplace(std::to_string(i), i);
+        CHECK(result.second);
+        CHECK(result.first->key() == string_view(std::to_string(i)));
+    }
+    auto it = doc.try_emplace(doc.object_range().begin() + 1, "new", 100);
+    CHECK(it->key() == string_view("new"));
+    CHECK(doc.erase("5") == 1);
+    CHECK(doc.at("39").as<int>() == 39);
+    CHECK((doc.object_range().begin() + 5)->key() == string_view("6"));
+}
+
 #endif
@@ -0,0 +1,360 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    using packed_json = basic_json<char,packed_arrays_policy<sorted_policy>>;
+    using packed_ojson = basic_json<char,packed_arrays_policy<ordered_policy>>;
+
+    template <typename Json>
+    bool is_packed(const Json& j)
+    {
+        return j.storage_kind() == json_storage_kind::array &&
+            j.template cast<typename Json::array_storage>().value().is_packed();
+    }
+
+    std::string make_array(std::size_t n, const std::string& first, const std::string& rest)
+    {
+        std::string s = "[" + first;
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            s.push_back(',');
+            s.append(rest);
+        }
+        s.push_back(']');
+        return s;
+    }
+
+    std::size_t& fail_allocations_from()
+    {
+        static std::size_t size = 0;
+        return size;
+    }
+
+    // Fails allocations of at least fail_allocations_from() bytes, when that is not 0
+    template <typename T>
+    struct failing_allocator
+    {
+        using value_type = T;
+
+        failing_allocator() = default;
+        template <typename U>
+        failing_allocator(const failing_allocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            if (fail_allocations_from() != 0 && n*sizeof(T) >= fail_allocations_from())
+            {
+                throw std::bad_alloc();
+            }
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        friend bool operator==(const failing_allocator&, const failing_allocator&) noexcept {return true;}
+        friend bool operator!=(const failing_allocator&, const failing_allocator&) noexcept {return false;}
+    };
+
+} // namespace
+
+TEST_CASE("packed_json_array parse tests")
+{
+    SECTION("arrays of one kind of number are packed")
+    {
+        std::vector<std::string> inputs = {
+            make_array(20, "1", "18446744073709551615"),
+            make_array(20, "-1", "-9223372036854775807"),
+            make_array(20, "1.5", "-0.25e-300")
+        };
+        for (const auto& input : inputs)
+        {
+            packed_json j = packed_json::parse(input);
+            json expected = json::parse(input);
+            CHECK(is_packed(j));
+            CHECK(j.size() == 20);
+            CHECK(j.to_string() == expected.to_string());
+            CHECK(json::parse(j.to_string()) == expected);
+            CHECK(is_packed(j));
+        }
+    }
+
+    SECTION("other arrays are not packed")
+    {
+        CHECK_FALSE(is_packed(packed_json::parse(make_array(20, "-1", "1"))));
+        CHECK_FALSE(is_packed(packed_json::parse(make_array(20, "1", "1.5"))));
+        CHECK_FALSE(is_packed(packed_json::parse(make_array(20, "\"a\"", "1"))));
+        CHECK_FALSE(is_packed(packed_json::parse(make_array(15, "1", "1"))));
+        CHECK_FALSE(is_packed(packed_json::parse("[]")));
+    }
+
+    SECTION("nested arrays")
+    {
+        std::string row = make_array(16, "0.5", "1.5");
+        std::string input = "{\"matrix\":[" + row + "," + row + "," + row + "],\"name\":\"m\"}";
+
+        packed_ojson j = packed_ojson::parse(input);
+        REQUIRE(j["matrix"].size() == 3);
+        CHECK(is_packed(j.at("matrix").at(2)));
+        CHECK(j.to_string() == ojson::parse(input).to_string());
+    }
+}
+
+TEST_CASE("packed_json_array element access tests")
+{
+    packed_json j = packed_json::parse(make_array(20, "7", "3"));
+    REQUIRE(is_packed(j));
+
+    SECTION("const access keeps the buffer")
+    {
+        const packed_json& c = j;
+        CHECK(c[0].as<int>() == 7);
+        CHECK(c.at(19).is_uint64());
+        std::size_t count = 0;
+        for (const auto& item : c.array_range())
+        {
+            count += item.as<std::size_t>();
+        }
+        CHECK(count == 7 + 19*3);
+        CHECK(is_packed(j));
+        CHECK(j.as<std::vector<uint64_t>>().size() == 20);
+    }
+
+    SECTION("non-const access unpacks")
+    {
+        j[1] = "two";
+        CHECK_FALSE(is_packed(j));
+        CHECK(j[1].as<std::string>() == "two");
+        CHECK(j[0].as<int>() == 7);
+        CHECK(j.size() == 20);
+    }
+
+    SECTION("push_back unpacks")
+    {
+        j.push_back(1.5);
+        CHECK_FALSE(is_packed(j));
+        CHECK(j.size() == 21);
+        CHECK(j[20].as<double>() == 1.5);
+    }
+
+    SECTION("erase")
+    {
+        j.erase(j.array_range().begin());
+        CHECK(j.size() == 19);
+        CHECK(j[0].as<int>() == 3);
+    }
+
+    SECTION("edit through const iterators")
+    {
+        const packed_json& c = j;
+        j.erase(c.array_range().begin());
+        CHECK_FALSE(is_packed(j));
+        CHECK(j.size() == 19);
+        CHECK(j[0].as<int>() == 3);
+
+        packed_json k = packed_json::parse(make_array(20, "7", "3"));
+        const packed_json& ck = k;
+        k.insert(ck.array_range().end(), 99);
+        CHECK_FALSE(is_packed(k));
+        REQUIRE(k.size() == 21);
+        CHECK(k[20].as<int>() == 99);
+        std::string expected = make_array(20, "7", "3");
+        expected.insert(expected.size() - 1, ",99");
+        CHECK(k.to_string() == expected);
+
+        packed_json m = packed_json::parse(make_array(20, "7", "3"));
+        const packed_json& cm = m;
+        m.erase(cm.array_range().begin() + 1, cm.array_range().end());
+        CHECK(m.size() == 1);
+        CHECK(m.to_string() == "[7]");
+
+        packed_json n = packed_json::parse(make_array(20, "7", "3"));
+        const packed_json& cn = n;
+        n.emplace(cn.array_range().begin(), "first");
+        CHECK(n.size() == 21);
+        CHECK(n[0].as<std::string>() == "first");
+        CHECK(packed_json(n)[1].as<int>() == 7);
+    }
+
+    SECTION("clear")
+    {
+        j.clear();
+        CHECK(j.empty());
+        j.push_back(1);
+        CHECK(j.size() == 1);
+    }
+
+    SECTION("copy, assign and compare")
+    {
+        packed_json copy(j);
+        CHECK(is_packed(copy));
+        CHECK(copy == j);
+
+        packed_json other = packed_json::parse(make_array(20, "7", "4"));
+        CHECK(other != j);
+        other = j;
+        CHECK(is_packed(other));
+        CHECK(other == j);
+
+        packed_json moved(std::move(copy));
+        CHECK(is_packed(moved));
+        CHECK(moved == j);
+
+        packed_json modified(j);
+        modified[0] = 8;
+        CHECK(modified != j);
+    }
+
+    SECTION("compare with expanded elements")
+    {
+        packed_json generic(json_array_arg);
+        for (int i = 0; i < 20; ++i)
+        {
+            generic.push_back(i == 0 ? 7 : 3);
+        }
+        CHECK_FALSE(is_packed(generic));
+        CHECK(generic == j);
+        CHECK(j == generic);
+    }
+
+    SECTION("shrink_to_fit keeps the buffer")
+    {
+        const packed_json& c = j;
+        CHECK(c[5].as<int>() == 3);
+        j.shrink_to_fit();
+        CHECK(is_packed(j));
+        CHECK(c[5].as<int>() == 3);
+    }
+}
+
+TEST_CASE("packed_json_array failed unpack tests")
+{
+    using failing_json = basic_json<char,packed_arrays_policy<sorted_policy>,failing_allocator<char>>;
+    std::string input = make_array(20, "7", "3");
+    failing_json j = failing_json::parse(input);
+    REQUIRE(is_packed(j));
+
+    fail_allocations_from() = 20*sizeof(failing_json);
+    CHECK_THROWS_AS(j[0], std::bad_alloc);
+    CHECK_THROWS_AS(j.push_back(1), std::bad_alloc);
+    fail_allocations_from() = 0;
+
+    const failing_json& c = j;
+    CHECK(c.size() == 20);
+    CHECK(c[19].as<int>() == 3);
+    CHECK(j.to_string() == input);
+    j[0] = 8;
+    CHECK(j.size() == 20);
+    CHECK(j[0].as<int>() == 8);
+    CHECK(j[1].as<int>() == 3);
+}
+
+TEST_CASE("packed_json_array as vector tests")
+{
+    std::vector<double> v = {0.5, 1.5, -2.25, 1e300, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0};
+    std::string input = json(v).to_string();
+
+    packed_json j = packed_json::parse(input);
+    REQUIRE(is_packed(j));
+    CHECK(j.as<std::vector<double>>() == v);
+    CHECK(j.as<std::vector<int>>()[1] == 1);
+    CHECK(is_packed(j));
+
+    packed_json k = packed_json::parse(make_array(16, "-3", "-4"));
+    REQUIRE(is_packed(k));
+    auto w = k.as<std::vector<int64_t>>();
+    CHECK(w.front() == -3);
+    CHECK(w.back() == -4);
+    CHECK(k.as<std::vector<double>>().back() == -4.0);
+}
+
+TEST_CASE("packed_json_array typed array tests")
+{
+    SECTION("float")
+    {
+        std::vector<float> v(32, 0.5f);
+        json_decoder<packed_json> decoder;
+        decoder.typed_array(jsoncons::span<const float>(v));
+        packed_json j = decoder.get_result();
+        CHECK(is_packed(j));
+        CHECK(j.size() == 32);
+        CHECK(j[31].as<double>() == 0.5);
+        CHECK(j.as<std::vector<float>>() == v);
+    }
+
+    SECTION("small integer types")
+    {
+        std::vector<int8_t> v(20, -5);
+        json_decoder<packed_json> decoder;
+        decoder.typed_array(jsoncons::span<const int8_t>(v));
+        packed_json j = decoder.get_result();
+        CHECK(is_packed(j));
+        CHECK(j.as<std::vector<int64_t>>() == std::vector<int64_t>(20, -5));
+        CHECK(j.as<std::vector<int>>() == std::vector<int>(20, -5));
+        CHECK(j[3].is_int64());
+    }
+
+    SECTION("half")
+    {
+        std::vector<uint16_t> v(20, 0x3c00);
+        json_decoder<packed_json> decoder;
+        decoder.typed_array(half_arg, jsoncons::span<const uint16_t>(v));
+        packed_json j = decoder.get_result();
+        CHECK(is_packed(j));
+        CHECK(j[0].as<double>() == 1.0);
+        CHECK(j.to_string() == make_array(20, "1.0", "1.0"));
+    }
+
+    SECTION("default policy expands typed arrays")
+    {
+        std::vector<uint32_t> v(20, 9);
+        json_decoder<json> decoder;
+        decoder.begin_object();
+        decoder.key("a");
+        decoder.typed_array(jsoncons::span<const uint32_t>(v));
+        decoder.end_object();
+        json j = decoder.get_result();
+        CHECK(j["a"].size() == 20);
+        CHECK(j["a"][19].as<int>() == 9);
+    }
+}
+
+TEST_CASE("packed_json_array concurrent const access tests")
+{
+    const packed_json j = packed_json::parse(make_array(1000, "1", "2"));
+    REQUIRE(is_packed(j));
+
+    std::vector<uint64_t> sums(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < sums.size(); ++t)
+    {
+        threads.emplace_back([&j, &sums, t]()
+        {
+            for (const auto& item : j.array_range())
+            {
+                sums[t] += item.as<uint64_t>();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (auto sum : sums)
+    {
+        CHECK(sum == 1 + 999*2);
+    }
+}
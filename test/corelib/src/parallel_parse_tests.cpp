@@ -0,0 +1,160 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/parallel_parse.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Elements with strings full of structural characters, quotes and backslashes,
+    // so that chunk boundaries often fall inside strings and escapes
+    std::string make_array(std::size_t count, std::size_t padding)
+    {
+        std::vector<std::string> strings = {
+            R"("a,b],[c")", R"("\"],\"[")", R"("\\")", R"("\\\\\",")", R"("{\"k\":[1,2]}")", "\"" + std::string(padding, ',') + "\""
+        };
+        std::string text = "[\n";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                text += i % 3 == 0 ? ",\n  " : ",";
+            }
+            switch (i % 4)
+            {
+                case 0:
+                    text += "{\"id\":" + std::to_string(i) + ",\"s\":" + strings[i % strings.size()] + ",\"a\":[[],{},[1,[2]]]}";
+                    break;
+                case 1:
+                    text += strings[i % strings.size()];
+                    break;
+                case 2:
+                    text += "[" + std::to_string(i) + ".25," + strings[(i+1) % strings.size()] + ",null]";
+                    break;
+                default:
+                    text += std::to_string(i);
+                    break;
+            }
+        }
+        text += "\n]";
+        return text;
+    }
+
+} // namespace
+
+TEST_CASE("parallel_parse top level array")
+{
+    for (std::size_t padding = 0; padding < 70; padding += 7)
+    {
+        std::string text = make_array(300, padding);
+        json expected = json::parse(text);
+
+        for (std::size_t threads : {2, 3, 4, 7})
+        {
+            auto options = parallel_parse_options{}.num_threads(threads).min_chunk_size(64);
+            json actual = parallel_parse<json>(text, options);
+            CHECK(actual == expected);
+        }
+    }
+}
+
+TEST_CASE("parallel_parse falls back to a sequential parse")
+{
+    auto options = parallel_parse_options{}.num_threads(4).min_chunk_size(64);
+
+    SECTION("not an array")
+    {
+        std::string text = "{\"a\":" + make_array(100, 3) + "}";
+        CHECK(parallel_parse<json>(text, options) == json::parse(text));
+    }
+    SECTION("small input")
+    {
+        CHECK(parallel_parse<json>("[1,2,3]") == json::parse("[1,2,3]"));
+    }
+    SECTION("one large element")
+    {
+        std::string text = "[" + make_array(100, 5) + "]";
+        CHECK(parallel_parse<json>(text, options) == json::parse(text));
+    }
+    SECTION("comments")
+    {
+        std::string text = make_array(100, 5);
+        text.insert(1, "/* \"[, */");
+        text.insert(text.size()/2, "// ,\"]\n");
+        json expected;
+        std::error_code expected_ec;
+        JSONCONS_TRY
+        {
+            expected = json::parse(text);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            expected_ec = e.code();
+        }
+        JSONCONS_TRY
+        {
+            CHECK(parallel_parse<json>(text, options) == expected);
+            CHECK_FALSE(expected_ec);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            CHECK(e.code() == expected_ec);
+        }
+    }
+}
+
+TEST_CASE("parallel_parse errors")
+{
+    auto options = parallel_parse_options{}.num_threads(4).min_chunk_size(64);
+    std::string text = make_array(200, 0);
+
+    std::vector<std::string> inputs = {
+        text.substr(0, text.size() - 1),
+        text.substr(0, text.size()/2) + "," + text.substr(text.size()/2),
+        "[," + text.substr(1),
+        text.substr(0, text.size() - 1) + ",]",
+        text + "]",
+        text + "[]",
+        "[" + text.substr(1, text.size()/2) + "]" + text.substr(text.size()/2)
+    };
+
+    for (const auto& input : inputs)
+    {
+        std::error_code expected;
+        std::size_t expected_line = 0;
+        std::size_t expected_column = 0;
+        JSONCONS_TRY
+        {
+            json::parse(input);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            expected = e.code();
+            expected_line = e.line();
+            expected_column = e.column();
+        }
+
+        std::error_code actual;
+        std::size_t actual_line = 0;
+        std::size_t actual_column = 0;
+        JSONCONS_TRY
+        {
+            parallel_parse<json>(input, options);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            actual = e.code();
+            actual_line = e.line();
+            actual_column = e.column();
+        }
+        CHECK(expected);
+        CHECK(actual == expected);
+        CHECK(actual_line == expected_line);
+        CHECK(actual_column == expected_column);
+    }
+}
@@ -126,3 +126,94 @@ TEST_CASE("test_parse_big_string2")
 #endif
 
 
+
+TEST_CASE("test_parse_long_string_special_at_every_offset")
+{
+    // exercises the vectorized text scanner with the special character at each lane position
+    for (std::size_t i = 0; i < 80; ++i)
+    {
+        std::string text(80, 'a');
+        std::string input = "\"" + text.substr(0, i) + "\\n" + text.substr(i) + "\"";
+        json j = json::parse(input);
+        CHECK(j.as<std::string>() == text.substr(0, i) + "\n" + text.substr(i));
+    }
+    for (std::size_t i = 0; i < 80; ++i)
+    {
+        std::string input = "\"" + std::string(i, 'a') + "\x01" + std::string(10, 'b') + "\"";
+        std::error_code ec;
+        json_decoder<json> decoder;
+        json_string_reader reader(input, decoder);
+        reader.read(ec);
+        CHECK(ec == json_errc::illegal_control_character);
+    }
+}
+
+TEST_CASE("test_parse_long_string_split_across_chunks")
+{
+    std::string expected;
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        expected += "lorem ipsum dolor sit amet \xC3\xA9 ";
+    }
+    std::string input = "[\"" + expected + "\",\"tail\"]";
+
+    for (std::size_t i = 1; i < input.length(); ++i)
+    {
+        json_decoder<json> decoder;
+        json_parser parser;
+        parser.update(input.data(), i);
+        parser.parse_some(decoder);
+        parser.update(input.data() + i, input.length() - i);
+        parser.parse_some(decoder);
+        parser.finish_parse(decoder);
+        REQUIRE(parser.done());
+        json j = decoder.get_result();
+        REQUIRE(j.size() == 2);
+        CHECK(j[0].as<std::string>() == expected);
+        CHECK(j[1].as<std::string>() == "tail");
+    }
+}
+
+TEST_CASE("test_parse_string_utf8_validation")
+{
+    SECTION("valid multibyte sequences")
+    {
+        std::string s = "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 end";
+        json j = json::parse("\"" + s + "\"");
+        CHECK(j.as<std::string>() == s);
+    }
+    SECTION("invalid sequences")
+    {
+        std::vector<std::string> invalid = {"\xC3\x28", "\xA0", "\xE2\x28\xA1", "\xF0\x28\x8C\x28", "\xC0\xAF", "\xF8\x88\x80\x80\x80", "\xED\xA0\x80"};
+        for (const auto& bad : invalid)
+        {
+            for (std::size_t i = 0; i < 40; i += 7)
+            {
+                std::string input = "[\"" + std::string(i, 'a') + bad + "\"]";
+                std::error_code ec;
+                json_decoder<json> decoder;
+                json_string_reader reader(input, decoder);
+                reader.read(ec);
+                CHECK(ec);
+            }
+        }
+    }
+    SECTION("invalid sequence split across chunks")
+    {
+        std::string input = "[\"abcdefghijklmnopq\xE2\x28\xA1rstuvwxyz\"]";
+        for (std::size_t i = 1; i < input.length(); ++i)
+        {
+            json_decoder<json> decoder;
+            json_parser parser;
+            std::error_code ec;
+            parser.update(input.data(), i);
+            parser.parse_some(decoder, ec);
+            if (!ec)
+            {
+                parser.update(input.data() + i, input.length() - i);
+                parser.parse_some(decoder, ec);
+            }
+            CHECK(ec);
+        }
+    }
+}
@@ -0,0 +1,238 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_compact.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/jsonpointer/jsonpointer.hpp>
+#include <jsoncons_ext/mergepatch/mergepatch.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string payload = R"({"items": [1, -2, 3.5, "four", true, null], "nested": {"a": []}})";
+
+    json make_envelope()
+    {
+        json envelope(json_object_arg);
+        envelope.try_emplace("id", 42);
+        envelope.try_emplace("payload", json(raw_json_arg, payload));
+        envelope.try_emplace("status", json(raw_json_arg, "\"ok\""));
+        return envelope;
+    }
+
+} // namespace
+
+TEST_CASE("raw_json storage tests")
+{
+    SECTION("a fragment is a string holding its text")
+    {
+        json j(raw_json_arg, "[1,2,3]");
+        CHECK(j.type() == json_type::string);
+        CHECK(j.is_string());
+        CHECK_FALSE(j.is_array());
+        CHECK(j.as_string_view() == "[1,2,3]");
+        CHECK(j.as<std::string>() == "[1,2,3]");
+        CHECK(std::string(j.as_cstring()) == "[1,2,3]");
+        CHECK(j.size() == 0);
+        CHECK_FALSE(j.empty());
+        CHECK(json(raw_json_arg, "").empty());
+        CHECK_THROWS(j[0]);
+        CHECK_FALSE(json(raw_json_arg, "42").is_uint64());
+    }
+
+    SECTION("accessors")
+    {
+        json j(raw_json_arg, payload);
+        CHECK(j.storage_kind() == json_storage_kind::raw_json);
+        CHECK(j.is_raw_json());
+        CHECK(j.as_raw_json() == payload);
+        CHECK_FALSE(j.is_object());
+        CHECK_FALSE(json("abc").is_raw_json());
+        CHECK_THROWS(json("abc").as_raw_json());
+    }
+
+    SECTION("copy, move and swap")
+    {
+        json j = make_envelope();
+        json copy(j);
+        CHECK(copy == j);
+        CHECK(copy["payload"].as_raw_json() == payload);
+
+        json moved(std::move(copy));
+        CHECK(moved == j);
+
+        json assigned(json_array_arg);
+        assigned = j["payload"];
+        CHECK(assigned.as_raw_json() == payload);
+        assigned = j["status"];
+        CHECK(assigned.as_raw_json() == "\"ok\"");
+
+        swap(moved["id"], moved["payload"]);
+        CHECK(moved["id"].as_raw_json() == payload);
+        CHECK(moved["payload"] == json(42));
+    }
+
+    SECTION("compare")
+    {
+        CHECK(json(raw_json_arg, "[1,2]") == json(raw_json_arg, "[1,2]"));
+        CHECK(json(raw_json_arg, "[1,2]") != json(raw_json_arg, "[1, 2]"));
+        CHECK(json(raw_json_arg, "[1,2]") != json::parse("[1,2]"));
+        CHECK(json(raw_json_arg, "[1,2]") == json("[1,2]"));
+        CHECK(json("[1,2]") == json(raw_json_arg, "[1,2]"));
+        CHECK(json(raw_json_arg, "42") != json(42));
+        CHECK(json(raw_json_arg, "a") < json(raw_json_arg, "b"));
+        CHECK(json("a") < json(raw_json_arg, "b"));
+        CHECK(json(raw_json_arg, "a") < json("b"));
+    }
+
+    SECTION("compact_copy")
+    {
+        json j = make_envelope();
+        json_arena arena;
+        auto copy = compact_copy(j, arena);
+        CHECK(copy["payload"].as_raw_json() == payload);
+    }
+}
+
+TEST_CASE("raw_json extension tests")
+{
+    json j = json::parse(R"({"p":[0],"o":{"k":1}})");
+    j["p"] = json(raw_json_arg, "[1,2,3]");
+    j["o"] = json(raw_json_arg, R"({"k":1})");
+
+    SECTION("jsonpath")
+    {
+        CHECK(jsonpath::json_query(j, "$.p[0]") == json(json_array_arg));
+        json result = jsonpath::json_query(j, "$.p");
+        REQUIRE(result.size() == 1);
+        CHECK(result[0].as_raw_json() == "[1,2,3]");
+    }
+
+    SECTION("jsonpointer")
+    {
+        CHECK(jsonpointer::get(j, "/p").as_raw_json() == "[1,2,3]");
+        std::error_code ec;
+        jsonpointer::get(j, "/o/k", ec);
+        CHECK(ec == jsonpointer::jsonpointer_errc::expected_object_or_array);
+    }
+
+    SECTION("mergepatch")
+    {
+        json target = j;
+        mergepatch::apply_merge_patch(target, json::parse(R"({"o":{"z":2}})"));
+        CHECK(target["o"] == json::parse(R"({"z":2})"));
+    }
+}
+
+TEST_CASE("raw_json encode tests")
+{
+    json j = make_envelope();
+
+    SECTION("compact")
+    {
+        std::string s;
+        j.dump(s);
+        CHECK(s == R"({"id":42,"payload":)" + payload + R"(,"status":"ok"})");
+    }
+
+    SECTION("in an array")
+    {
+        json a(json_array_arg);
+        a.emplace_back(raw_json_arg, "1");
+        a.emplace_back(raw_json_arg, "{}");
+        a.emplace_back(2);
+
+        std::string s;
+        a.dump(s);
+        CHECK(s == "[1,{},2]");
+
+        std::string pretty;
+        a.dump_pretty(pretty);
+        std::string expected;
+        json::parse(s).dump_pretty(expected);
+        CHECK(pretty == expected);
+    }
+
+    SECTION("indented")
+    {
+        std::string s;
+        j.dump_pretty(s);
+        CHECK(s.find(payload) != std::string::npos);
+    }
+
+    SECTION("binary formats transcode the fragment")
+    {
+        json parsed = json::parse(j.to_string());
+
+        std::vector<uint8_t> expected;
+        cbor::encode_cbor(parsed, expected);
+        std::vector<uint8_t> actual;
+        cbor::encode_cbor(j, actual);
+        CHECK(actual == expected);
+
+        expected.clear();
+        msgpack::encode_msgpack(parsed, expected);
+        actual.clear();
+        msgpack::encode_msgpack(j, actual);
+        CHECK(actual == expected);
+    }
+
+    SECTION("other visitors receive the parsed fragment")
+    {
+        json_decoder<json> decoder;
+        j.dump(decoder);
+        json result = decoder.get_result();
+        CHECK(result["payload"] == json::parse(payload));
+        CHECK(result["status"] == json("ok"));
+    }
+
+    SECTION("visitors that do not accept raw text")
+    {
+        json_decoder<json> decoder;
+        CHECK_FALSE(decoder.accepts_raw_json());
+        std::error_code ec;
+        decoder.raw_json_value("[1]", ser_context(), ec);
+        CHECK(ec == json_errc::unexpected_raw_json);
+
+        std::string s;
+        compact_json_string_encoder encoder(s);
+        basic_json_tee<char> tee(decoder, encoder);
+        CHECK_FALSE(tee.accepts_raw_json());
+        j.dump(tee);
+        CHECK(decoder.get_result()["payload"] == json::parse(payload));
+    }
+
+    SECTION("filters forward raw text")
+    {
+        std::string s;
+        compact_json_string_encoder encoder(s);
+        json_filter filter(encoder);
+        CHECK(filter.accepts_raw_json());
+        j.dump(filter);
+        CHECK(s == j.to_string());
+
+        json_decoder<json> decoder;
+        json_filter decoder_filter(decoder);
+        CHECK_FALSE(decoder_filter.accepts_raw_json());
+        j.dump(decoder_filter);
+        CHECK(decoder.get_result()["payload"] == json::parse(payload));
+    }
+
+    SECTION("invalid fragment")
+    {
+        json bad(json_array_arg);
+        bad.emplace_back(raw_json_arg, "[1,");
+        std::vector<uint8_t> data;
+        auto r = cbor::try_encode_cbor(bad, data);
+        CHECK_FALSE(r);
+    }
+}
@@ -0,0 +1,185 @@
+// Copyright 2013-2026 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/sink.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <catch/catch.hpp>
+#include <cstdint>
+#include <deque>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // A sink with only push_back and append
+    class vector_sink
+    {
+        std::vector<uint8_t>* buf_ptr_;
+    public:
+        using value_type = uint8_t;
+
+        vector_sink(std::vector<uint8_t>& buf)
+            : buf_ptr_(&buf)
+        {
+        }
+
+        void flush()
+        {
+        }
+
+        void append(const uint8_t* s, std::size_t length)
+        {
+            buf_ptr_->insert(buf_ptr_->end(), s, s + length);
+        }
+
+        void push_back(uint8_t ch)
+        {
+            buf_ptr_->push_back(ch);
+        }
+    };
+
+} // namespace
+
+TEST_CASE("is_span_sink tests")
+{
+    CHECK(is_span_sink<stream_sink<char>>::value);
+    CHECK(is_span_sink<binary_stream_sink>::value);
+    CHECK(is_span_sink<string_sink<std::string>>::value);
+    CHECK(is_span_sink<bytes_sink<std::vector<uint8_t>>>::value);
+    CHECK_FALSE(is_span_sink<bytes_sink<std::deque<uint8_t>>>::value);
+    CHECK_FALSE(is_span_sink<vector_sink>::value);
+    CHECK_FALSE(is_span_sink<std::string>::value);
+}
+
+TEST_CASE("sink prepare and commit tests")
+{
+    SECTION("string_sink")
+    {
+        std::string s = "ab";
+        string_sink<std::string> sink(s);
+        char* p = sink.prepare(10);
+        p[0] = 'c';
+        p[1] = 'd';
+        sink.commit(2);
+        sink.push_back('e');
+        CHECK(s == "abcde");
+    }
+    SECTION("bytes_sink")
+    {
+        std::vector<uint8_t> v = {1};
+        bytes_sink<std::vector<uint8_t>> sink(v);
+        uint8_t* p = sink.prepare(4);
+        p[0] = 2;
+        sink.commit(1);
+        CHECK(v == std::vector<uint8_t>{1, 2});
+    }
+    SECTION("stream_sink flushes and grows its buffer")
+    {
+        std::ostringstream os;
+        {
+            stream_sink<char> sink(os, 4);
+            sink.append("abc", 3);
+            char* p = sink.prepare(3);
+            CHECK(os.str() == "abc");
+            p[0] = 'd';
+            sink.commit(1);
+
+            p = sink.prepare(10);
+            for (int i = 0; i < 10; ++i)
+            {
+                p[i] = static_cast<char>('0' + i);
+            }
+            sink.commit(10);
+            sink.push_back('e');
+        }
+        CHECK(os.str() == "abcd0123456789e");
+    }
+    SECTION("binary_stream_sink")
+    {
+        std::ostringstream os;
+        {
+            binary_stream_sink sink(os, 2);
+            append_big_endian(uint32_t(0x01020304), sink);
+            append_big_endian(uint16_t(0x0506), sink);
+        }
+        CHECK(os.str() == std::string("\x01\x02\x03\x04\x05\x06"));
+    }
+}
+
+TEST_CASE("formatting numbers into span sinks")
+{
+    SECTION("from_integer")
+    {
+        std::string s;
+        string_sink<std::string> sink(s);
+        CHECK(jsoncons::from_integer(int64_t(-1234567890123), sink) == 14);
+        sink.push_back(' ');
+        CHECK(jsoncons::from_integer(uint64_t(0), sink) == 1);
+        sink.push_back(' ');
+        CHECK(jsoncons::from_integer((std::numeric_limits<uint64_t>::max)(), sink) == 20);
+        CHECK(s == "-1234567890123 0 18446744073709551615");
+    }
+    SECTION("doubles")
+    {
+        std::ostringstream os;
+        {
+            stream_sink<char> sink(os, 8);
+            jsoncons::dtoa_general(-1.5e-7, '.', sink);
+            sink.push_back(' ');
+            jsoncons::dtoa_general(123456.789, '.', sink);
+            sink.push_back(' ');
+            jsoncons::dtoa_fixed(1e22, '.', sink);
+        }
+        CHECK(os.str() == "-1.5e-07 123456.789 10000000000000000000000.0");
+    }
+    SECTION("wide strings")
+    {
+        std::wstring s;
+        string_sink<std::wstring> sink(s);
+        jsoncons::from_integer(-42, sink);
+        sink.push_back(L' ');
+        jsoncons::dtoa_general(0.25, '.', sink);
+        CHECK(s == L"-42 0.25");
+    }
+}
+
+TEST_CASE("binary encoders with and without span sinks")
+{
+    json j = json::parse(R"(
+    {
+        "short": 1, "medium": 70000, "long": 5000000000, "negative": -70000,
+        "double": 1.5, "text": "a string that is longer than twenty three bytes",
+        "array": [1, 2, 3]
+    }
+    )");
+
+    SECTION("cbor")
+    {
+        std::vector<uint8_t> expected;
+        {
+            cbor::basic_cbor_encoder<vector_sink> encoder(expected);
+            j.dump(encoder);
+        }
+        std::vector<uint8_t> v;
+        cbor::encode_cbor(j, v);
+        CHECK(v == expected);
+        CHECK(cbor::decode_cbor<json>(v) == j);
+    }
+    SECTION("msgpack")
+    {
+        std::vector<uint8_t> expected;
+        {
+            msgpack::basic_msgpack_encoder<vector_sink> encoder(expected);
+            j.dump(encoder);
+        }
+        std::vector<uint8_t> v;
+        msgpack::encode_msgpack(j, v);
+        CHECK(v == expected);
+        CHECK(msgpack::decode_msgpack<json>(v) == j);
+    }
+}
@@ -3,13 +3,86 @@
 
 #include <jsoncons/json.hpp>
 #include <catch/catch.hpp>
+#include <cstdint>
+#include <limits>
+#include <string>
 
 using namespace jsoncons;
 
 TEST_CASE("utility::from_integer tests")
 {
-    SECTION("")
+    SECTION("int64_t")
     {
+        std::string s;
+        CHECK(jsoncons::from_integer(int64_t(0), s) == 1);
+        CHECK(s == "0");
+
+        s.clear();
+        CHECK(jsoncons::from_integer(int64_t(-7), s) == 2);
+        CHECK(s == "-7");
+
+        s.clear();
+        CHECK(jsoncons::from_integer(int64_t(100), s) == 3);
+        CHECK(s == "100");
+
+        s.clear();
+        CHECK(jsoncons::from_integer((std::numeric_limits<int64_t>::min)(), s) == 20);
+        CHECK(s == "-9223372036854775808");
+
+        s.clear();
+        CHECK(jsoncons::from_integer((std::numeric_limits<int64_t>::max)(), s) == 19);
+        CHECK(s == "9223372036854775807");
     }
-}
+    SECTION("uint64_t")
+    {
+        std::string s;
+        CHECK(jsoncons::from_integer((std::numeric_limits<uint64_t>::max)(), s) == 20);
+        CHECK(s == "18446744073709551615");
+    }
+    SECTION("small types")
+    {
+        std::string s;
+        jsoncons::from_integer(int8_t(-128), s);
+        CHECK(s == "-128");
 
+        s.clear();
+        jsoncons::from_integer(uint8_t(255), s);
+        CHECK(s == "255");
+    }
+    SECTION("every width")
+    {
+        int64_t value = 1;
+        std::string expected = "1";
+        for (int i = 0; i < 18; ++i)
+        {
+            std::string s;
+            jsoncons::from_integer(value, s);
+            CHECK(s == expected);
+
+            s.clear();
+            jsoncons::from_integer(-value, s);
+            CHECK(s == "-" + expected);
+
+            value = value * 10 + (i % 9) + 1;
+            expected.push_back(static_cast<char>('1' + (i % 9)));
+        }
+    }
+    SECTION("wide characters")
+    {
+        std::wstring s;
+        jsoncons::from_integer(-1234567, s);
+        CHECK(s == L"-1234567");
+    }
+#if defined(JSONCONS_HAS_INT128)
+    SECTION("int128")
+    {
+        std::string s;
+        jsoncons::from_integer((ext_traits::integer_limits<int128_type>::min)(), s);
+        CHECK(s == "-170141183460469231731687303715884105728");
+
+        s.clear();
+        jsoncons::from_integer((ext_traits::integer_limits<uint128_type>::max)(), s);
+        CHECK(s == "340282366920938463463374607431768211455");
+    }
+#endif
+}
@@ -3,6 +3,9 @@
 
 #include <jsoncons/utility/read_number.hpp>
 #include <clocale>
+#include <cmath>
+#include <limits>
+#include <string>
 #include <iostream>
 #include <catch/catch.hpp>
 
@@ -70,6 +73,30 @@ TEST_CASE("jsoncons::to_integer tests")
 
 TEST_CASE("utility::dec_to_integer tests")
 {
+    SECTION("runs of eight digits")
+    {
+        std::string s = "18446744073709551615";
+        uint64_t u = 0;
+        CHECK(jsoncons::dec_to_integer(s.data(), s.length(), u));
+        CHECK(u == (std::numeric_limits<uint64_t>::max)());
+
+        std::string t = "18446744073709551616";
+        CHECK(jsoncons::dec_to_integer(t.data(), t.length(), u).ec == std::errc::result_out_of_range);
+        CHECK(jsoncons::to_integer(t.data(), t.length(), u).ec == std::errc::result_out_of_range);
+
+        std::string v = "123456789x12";
+        auto result = jsoncons::dec_to_integer(v.data(), v.length(), u);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.ptr == v.data() + 9);
+        result = jsoncons::to_integer(v.data(), v.length(), u);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.ptr == v.data() + 9);
+
+        std::wstring w = L"1234567890123456789";
+        int64_t i = 0;
+        CHECK(jsoncons::dec_to_integer(w.data(), w.length(), i));
+        CHECK(i == 1234567890123456789);
+    }
     SECTION("")
     {
         std::string s = "-";
@@ -182,3 +209,71 @@ TEST_CASE("jsoncons::decstr_to_double tests")
         std::setlocale(LC_ALL, prev_loc.c_str());
     }
 }
+
+TEST_CASE("jsoncons::decstr_to_double rounding tests")
+{
+    auto to_double = [](const std::string& s) -> double
+    {
+        double val{0};
+        auto result = jsoncons::decstr_to_double(s.data(), s.length(), val);
+        CHECK(result);
+        CHECK(result.ptr == s.data() + s.length());
+        return val;
+    };
+
+    SECTION("exact and Clinger range")
+    {
+        CHECK(to_double("0") == 0.0);
+        CHECK(std::signbit(to_double("-0")));
+        CHECK(to_double("1.5") == 1.5);
+        CHECK(to_double("-123.456e3") == -123456.0);
+        CHECK(to_double("9007199254740993") == 9007199254740992.0);
+        CHECK(to_double("1e23") == 1e23);
+    }
+    SECTION("boundaries")
+    {
+        CHECK(to_double("1.7976931348623157e308") == (std::numeric_limits<double>::max)());
+        CHECK(to_double("2.2250738585072014e-308") == (std::numeric_limits<double>::min)());
+        CHECK(to_double("4.9406564584124654e-324") == std::numeric_limits<double>::denorm_min());
+        CHECK(to_double("2.4703282292062328e-324") == std::numeric_limits<double>::denorm_min());
+        CHECK(to_double("2.2250738585072011e-308") == 2.2250738585072011e-308);
+    }
+    SECTION("halfway cases decided by digits past the 19th")
+    {
+        // 1 + 2^-53 is halfway between 1 and the next double
+        CHECK(to_double("1.00000000000000011102230246251565404236316680908203125") == 1.0);
+        CHECK(to_double("1.00000000000000011102230246251565404236316680908203126") == 1.0000000000000002);
+        CHECK(to_double("1.00000000000000011102230246251565404236316680908203124") == 1.0);
+        CHECK(to_double("9007199254740993.0000000000000000000000000000001") == 9007199254740994.0);
+    }
+    SECTION("long mantissa")
+    {
+        std::string s = "0." + std::string(900, '0') + "1e901";
+        CHECK(to_double(s) == 1.0);
+        std::string t = "1" + std::string(400, '0') + "e-400";
+        CHECK(to_double(t) == 1.0);
+    }
+    SECTION("underflow")
+    {
+        std::string s = "1e-400";
+        double val{1};
+        auto result = jsoncons::decstr_to_double(s.data(), s.length(), val);
+        CHECK(result.ec == std::errc::result_out_of_range);
+        CHECK(val == 0.0);
+    }
+    SECTION("wide characters")
+    {
+        std::wstring s = L"1.00000000000000011102230246251565404236316680908203126";
+        double val{0};
+        auto result = jsoncons::decstr_to_double(s.data(), s.length(), val);
+        CHECK(result);
+        CHECK(val == 1.0000000000000002);
+    }
+    SECTION("not plain decimal")
+    {
+        std::string s = "1.5x";
+        double val{0};
+        auto result = jsoncons::decstr_to_double(s.data(), s.length(), val);
+        CHECK((!result || result.ptr != s.data() + s.length()));
+    }
+}